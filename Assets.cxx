@@ -0,0 +1,135 @@
+/**
+*
+* @file Assets.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Logo et textes d'aide, lus une seule fois
+*
+*/
+
+#include <fstream>
+#include <map>
+
+#include "Assets.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		struct CAsset
+		{
+			const char * Name;
+			const char * Default;  ///< Used when the file is missing
+		}; // CAsset
+
+		const CAsset KAssets [] =
+		{
+			{ "logo",
+R"(  _   _                 _                  ____                _
+ | \ | |_   _ _ __ ___ | |__   ___ _ __   / ___|_ __ _   _ ___| |__
+ |  \| | | | | '_ ` _ \| '_ \ / _ \ '__| | |   | '__| | | / __| '_ \
+ | |\  | |_| | | | | | | |_) |  __/ |    | |___| |  | |_| \__ \ | | |
+ |_| \_|\__,_|_| |_| |_|_.__/ \___|_|     \____|_|   \__,_|___/_| |_|
+
+)" },
+			{ "aide.txt",
+R"(NumberCrush - mode standard
+
+Alignez au moins trois nombres identiques, en ligne ou en colonne.
+A chaque tour, donnez la ligne puis la colonne du nombre à déplacer,
+puis la direction de l'échange avec son voisin :
+  A - Gauche   Z - Haut   E - Droite   S - Bas
+Les nombres alignés disparaissent, la grille se tasse et de nouveaux
+alignements peuvent se former en cascade.
+
+Points : 3 nombres alignés = 3, 4 = 6, 5 et plus = 9.
+La partie s'arrête quand aucun déplacement n'aligne plus rien ou quand
+les coups sont épuisés (40 en facile, 35 en moyen, 30 en difficile).
+Q à la place de la direction abandonne la partie (score nul).
+)" },
+			{ "help.txt",
+R"(NumberCrush - standard mode
+
+Line up at least three identical numbers, in a line or a column.
+Each round, give the line then the column of the number to move, then
+the direction of the swap with its neighbour :
+  A - Left   Z - Top   E - Right   S - Bottom
+Aligned numbers vanish, the grid settles down and new alignments may
+appear in cascade.
+
+Points : 3 aligned numbers = 3, 4 = 6, 5 or more = 9.
+The game ends when no move aligns anything any more or when no move is
+left (40 in easy, 35 in medium, 30 in hard).
+Q instead of a direction gives up the game (score of 0).
+)" },
+			{ "aide2.txt",
+R"(NumberCrush - mode chrono
+
+Alignez au moins trois nombres identiques, en ligne ou en colonne.
+A chaque tour, donnez la ligne puis la colonne du nombre à déplacer,
+puis la direction de l'échange avec son voisin :
+  A - Gauche   Z - Haut   E - Droite   S - Bas
+Les nombres alignés disparaissent, la grille se tasse et de nouveaux
+alignements peuvent se former en cascade.
+
+Points : 3 nombres alignés = 3, 4 = 6, 5 et plus = 9.
+Les coups sont illimités mais le temps est compté : 120 s en facile et
+en moyen, 90 s en difficile.
+Q à la place de la direction abandonne la partie (score nul).
+)" },
+			{ "help2.txt",
+R"(NumberCrush - chrono mode
+
+Line up at least three identical numbers, in a line or a column.
+Each round, give the line then the column of the number to move, then
+the direction of the swap with its neighbour :
+  A - Left   Z - Top   E - Right   S - Bottom
+Aligned numbers vanish, the grid settles down and new alignments may
+appear in cascade.
+
+Points : 3 aligned numbers = 3, 4 = 6, 5 or more = 9.
+Moves are unlimited but time is short : 120 s in easy and medium, 90 s
+in hard.
+Q instead of a direction gives up the game (score of 0).
+)" },
+		};
+
+		typedef map <string, string> CAssets;
+
+		// Le fichier, ligne par ligne, ou le texte par défaut
+		string Load (const CAsset & Asset)
+		{
+			ifstream ifs (Asset.Name);
+			string Text;
+			for (string LineFile; getline (ifs, LineFile); )
+				Text += LineFile + '\n';
+			return Text.empty () ? string (Asset.Default) : Text;
+		} // Load
+
+		CAssets LoadAll ()
+		{
+			CAssets Assets;
+			for (unsigned i = 0; i < sizeof (KAssets) / sizeof (KAssets [0]);
+				 ++i)
+				Assets [KAssets [i].Name] = Load (KAssets [i]);
+			return Assets;
+		} // LoadAll
+
+	} // namespace
+
+	const string & GetAsset (const string & Name)
+	{
+		// Initialisée au premier appel, une seule fois même entre threads
+		static const CAssets Assets = LoadAll ();
+		static const string  None;
+
+		const CAssets::const_iterator Found = Assets.find (Name);
+		return Found == Assets.end () ? None : Found->second;
+	} // GetAsset
+
+} // namespace nsNumberCrush
@@ -0,0 +1,36 @@
+/**
+*
+* @file Assets.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Logo et textes d'aide, lus une seule fois
+*
+*/
+
+#ifndef __ASSETS_H__
+#define __ASSETS_H__
+
+#include <string>
+
+namespace nsNumberCrush
+{
+/**
+ * \fn const std::string & GetAsset (const std::string & Name)
+ * \brief Content of the text file Name ("logo", "aide.txt", "help.txt",
+ *  "aide2.txt", "help2.txt"), every line ending with a new line
+ *
+ * The first call reads every file of the current directory once ; a
+ *  missing or empty file is replaced by the text built into the game.
+ *  The texts never change afterwards and can be shared between threads.
+ *
+ * \return An empty text if Name is none of the above
+ *
+ */
+	const std::string & GetAsset (const std::string & Name);
+
+} // namespace nsNumberCrush
+
+#endif /* __ASSETS_H__ */
@@ -0,0 +1,381 @@
+/**
+*
+* @file BenchEngine.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Mesure chaque primitive du moteur, par taille de grille et
+*        nombre de bonbons ; sortie en texte ou en JSON
+*
+* BenchEngine [--json] [--filter Name] [--min-time Seconds]
+*
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <algorithm>
+
+#include "Engine.h"
+#include "Hint.h"
+#include "RowScan.h"
+
+using namespace std;
+using namespace nsNumberCrush;
+
+namespace
+{
+	typedef chrono::steady_clock CClock;
+
+	const unsigned KSizes []     = { 8, 10, 16, 32, 64, 128, 256, 1024 };
+	const unsigned KNbCandies [] = { 4, 6, 8 };
+	const unsigned KNbGrids      = 16;
+	const unsigned KCellsPerCase = 1 << 18; // moins de grilles si grandes
+
+/**
+ * \struct CCase
+ * \brief Grids measured together, and what the timed code may need
+ *
+ */
+	struct CCase
+	{
+		unsigned Size;
+		unsigned NbCandies;
+		CRandom  Rng;
+	}; // CCase
+
+	// Une opération sur une grille ; le résultat évite qu'elle disparaisse
+	typedef unsigned (*COperation) (CGrid & Grid, CCase & Case);
+
+/**
+ * \struct CBench
+ * \brief One primitive : Mutates tells if it changes the grid, which
+ *  must then be copied again (out of the timing) before each call
+ *
+ */
+	struct CBench
+	{
+		const char * Name;
+		COperation   Run;
+		bool         Mutates;
+		int          RowScan;  ///< Version of RowStarts measured, or -1
+		bool         Planes;   ///< On grids keeping the bitboard planes
+	}; // CBench
+
+	unsigned RunInitGrid (CGrid & Grid, CCase & Case)
+	{
+		InitGrid (Grid, Case.Size, Case.NbCandies, Case.Rng);
+		return Grid (0, 0);
+	} // RunInitGrid
+
+	// Chaque ligne de la grille, avec une version donnée
+	template <CRowScan Scan>
+	unsigned RunRowStarts (CGrid & Grid, CCase &)
+	{
+		static vector <CWord> Starts;
+		Starts.resize (Grid.GetNbWords ());
+		unsigned Nb = 0;
+		for (unsigned i = 0; i < Grid.GetNbRows (); ++i)
+		{
+			RowStarts (Scan, Grid.GetLine (i), Grid.GetNbCols (), &Starts [0]);
+			Nb += Starts [0] != 0;
+		}
+		return Nb;
+	} // RunRowStarts
+
+	// Une recherche par ligne, comme le faisait NumberCrushV1
+	unsigned RunAtLeastThreeInARow (CGrid & Grid, CCase &)
+	{
+		unsigned Nb = 0;
+		unsigned HowMany;
+		CPosition Pos;
+		for (unsigned i = 0; i < Grid.GetNbRows (); ++i)
+		{
+			Pos = make_pair (i, 0);
+			Nb += AtLeastThreeInARow (Grid, Pos, HowMany);
+		}
+		return Nb;
+	} // RunAtLeastThreeInARow
+
+	unsigned RunAtLeastThreeInAColumn (CGrid & Grid, CCase &)
+	{
+		unsigned Nb = 0;
+		unsigned HowMany;
+		CPosition Pos;
+		for (unsigned i = 0; i < Grid.GetNbCols (); ++i)
+		{
+			Pos = make_pair (0, i);
+			Nb += AtLeastThreeInAColumn (Grid, Pos, HowMany);
+		}
+		return Nb;
+	} // RunAtLeastThreeInAColumn
+
+	unsigned RunFindMatches (CGrid & Grid, CCase &)
+	{
+		static vector <CRun> Runs;
+		FindMatches (Grid, Runs);
+		return Runs.size ();
+	} // RunFindMatches
+
+	// Autour d'un échange au milieu de la grille, comme après un coup
+	unsigned RunFindMatchesSwap (CGrid & Grid, CCase & Case)
+	{
+		static vector <CRun> Runs;
+		static vector <CPosition> Swapped (2);
+		const unsigned Middle = Case.Size / 2 - 1;
+		Swapped [0] = CPosition (Middle, Middle);
+		Swapped [1] = CPosition (Middle, Middle + 1);
+		FindMatches (Grid, Swapped, Runs);
+		return Runs.size ();
+	} // RunFindMatchesSwap
+
+	// Trois cases au milieu de la grille, puis la gravité
+	unsigned RunRemovalInRow (CGrid & Grid, CCase & Case)
+	{
+		const unsigned Middle = Case.Size / 2 - 1;
+		RemovalInRow (Grid, CPosition (Middle, Middle), 3);
+		return Grid (Middle, Middle);
+	} // RunRemovalInRow
+
+	unsigned RunRemovalInColumn (CGrid & Grid, CCase & Case)
+	{
+		const unsigned Middle = Case.Size / 2 - 1;
+		RemovalInColumn (Grid, CPosition (Middle, Middle), 3);
+		return Grid (Middle, Middle);
+	} // RunRemovalInColumn
+
+	// La première colonne : toutes les autres sont décalées
+	unsigned RunRemovalFullColumn (CGrid & Grid, CCase &)
+	{
+		RemovalFullColumn (Grid, CPosition (0, 0));
+		return Grid (0, 0);
+	} // RunRemovalFullColumn
+
+	unsigned RunNombreCombiRestante (CGrid & Grid, CCase &)
+	{
+		unsigned CptTot;
+		return NombreCombiRestante (CptTot, Grid) + CptTot;
+	} // RunNombreCombiRestante
+
+	// Toute la cascade d'une grille tirée au hasard, jusqu'à stabilité
+	unsigned RunCascade (CGrid & Grid, CCase &)
+	{
+		static CCascadeStats Stats;
+		unsigned Score = 0;
+		Resolve (Grid, Score, Stats);
+		return Score;
+	} // RunCascade
+
+	// Clé de la table de transposition des indices
+	unsigned RunHashGrid (CGrid & Grid, CCase &)
+	{
+		return HashGrid (Grid);
+	} // RunHashGrid
+
+	const CBench KBenches [] =
+	{
+		{ "InitGrid",              RunInitGrid,              false, -1, false },
+		{ "RowStarts/scalar", RunRowStarts <KRowScanScalar>, false,
+		  KRowScanScalar, false },
+		{ "RowStarts/sse2",   RunRowStarts <KRowScanSse2>,   false,
+		  KRowScanSse2, false },
+		{ "RowStarts/avx2",   RunRowStarts <KRowScanAvx2>,   false,
+		  KRowScanAvx2, false },
+		{ "AtLeastThreeInARow",    RunAtLeastThreeInARow,    false, -1, false },
+		{ "AtLeastThreeInAColumn", RunAtLeastThreeInAColumn, false, -1, false },
+		{ "FindMatches",           RunFindMatches,           false, -1, false },
+		{ "FindMatches/swap",      RunFindMatchesSwap,       false, -1, false },
+		{ "FindMatches/planes",    RunFindMatches,           false, -1, true },
+		{ "FindMatches/swap/planes", RunFindMatchesSwap,     false, -1, true },
+		{ "RemovalInRow",          RunRemovalInRow,          true,  -1, false },
+		{ "RemovalInColumn",       RunRemovalInColumn,       true,  -1, false },
+		{ "RemovalFullColumn",     RunRemovalFullColumn,     true,  -1, false },
+		{ "NombreCombiRestante",   RunNombreCombiRestante,   false, -1, false },
+		{ "Cascade",               RunCascade,               true,  -1, false },
+		{ "Cascade/planes",        RunCascade,               true,  -1, true },
+		{ "HashGrid",              RunHashGrid,              false, -1, false }
+	};
+
+/**
+ * \struct CResult
+ * \brief Average time of one operation on one grid
+ *
+ */
+	struct CResult
+	{
+		string             Name;
+		unsigned           Size;
+		unsigned           NbCandies;
+		double             Ns;
+		unsigned long long NbOps;
+	}; // CResult
+
+	// Les grilles de Bench, hors du temps mesuré
+	void CopyGrids (const CBench & Bench, const vector <CGrid> & Grids,
+					vector <CGrid> & Work)
+	{
+		Work = Grids;
+		if (!Bench.Planes) return;
+		for (unsigned i = 0; i < Work.size (); ++i)
+			Work [i].KeepColumns (false);
+	} // CopyGrids
+
+/**
+ * \fn double Measure (const CBench & Bench, const vector <CGrid> & Grids,
+ *  CCase & Case, unsigned long long & NbOps, double MinTime)
+ * \brief Run Bench on every grid until MinTime seconds have been timed
+ * \return Average time of one operation, in nanoseconds
+ *
+ */
+	double Measure (const CBench & Bench, const vector <CGrid> & Grids,
+					CCase & Case, unsigned long long & NbOps, double MinTime)
+	{
+		vector <CGrid> Work;
+		CopyGrids (Bench, Grids, Work);
+		volatile unsigned Sink = 0;
+		NbOps = 0;
+		CClock::duration Timed (0);
+
+		// Un premier passage, non compté, pour chauffer les caches
+		for (unsigned i = 0; i < Work.size (); ++i)
+			Sink = Sink + Bench.Run (Work [i], Case);
+
+		while (chrono::duration <double> (Timed).count () < MinTime)
+		{
+			if (Bench.Mutates) CopyGrids (Bench, Grids, Work);
+			const CClock::time_point Debut = CClock::now ();
+			for (unsigned i = 0; i < Work.size (); ++i)
+				Sink = Sink + Bench.Run (Work [i], Case);
+			Timed += CClock::now () - Debut;
+			NbOps += Work.size ();
+		}
+		return chrono::duration <double, nano> (Timed).count () / NbOps;
+	} // Measure
+
+	string JsonTime ()
+	{
+		char Text [32];
+		const time_t Now = time (NULL);
+		strftime (Text, sizeof (Text), "%Y-%m-%dT%H:%M:%SZ", gmtime (&Now));
+		return Text;
+	} // JsonTime
+
+	void PrintJson (const vector <CResult> & Results, double MinTime)
+	{
+		cout << "{" << endl
+			 << "  \"context\": {" << endl
+			 << "    \"date\": \"" << JsonTime () << "\"," << endl
+#ifdef __VERSION__
+			 << "    \"compiler\": \"" << __VERSION__ << "\"," << endl
+#endif
+#ifdef NDEBUG
+			 << "    \"assertions\": false," << endl
+#else
+			 << "    \"assertions\": true," << endl
+#endif
+			 << "    \"row_scan\": \"" << GetRowScanName (GetRowScan ())
+			 << "\"," << endl
+			 << "    \"min_time\": " << MinTime << "," << endl
+			 << "    \"max_grids\": " << KNbGrids << endl
+			 << "  }," << endl
+			 << "  \"benchmarks\": [" << endl;
+		for (unsigned i = 0; i < Results.size (); ++i)
+		{
+			const CResult & Result = Results [i];
+			cout << "    { \"name\": \"" << Result.Name << "\", "
+				 << "\"size\": " << Result.Size << ", "
+				 << "\"candies\": " << Result.NbCandies << ", "
+				 << "\"ns_per_op\": " << fixed << setprecision (2)
+				 << Result.Ns << ", "
+				 << "\"iterations\": " << Result.NbOps << " }"
+				 << (i + 1 < Results.size () ? "," : "") << endl;
+		}
+		cout << "  ]" << endl << "}" << endl;
+	} // PrintJson
+
+	void PrintTable (const vector <CResult> & Results)
+	{
+		cout << "Row scan : " << GetRowScanName (GetRowScan ()) << endl
+			 << left << setw (24) << "Benchmark" << right
+			 << setw (8) << "Size" << setw (9) << "Candies"
+			 << setw (14) << "ns/op" << setw (14) << "ops" << endl;
+		for (unsigned i = 0; i < Results.size (); ++i)
+			cout << left << setw (24) << Results [i].Name << right
+				 << setw (8) << Results [i].Size
+				 << setw (9) << Results [i].NbCandies
+				 << setw (14) << fixed << setprecision (1) << Results [i].Ns
+				 << setw (14) << Results [i].NbOps << endl;
+	} // PrintTable
+
+	void Usage (const char * Name)
+	{
+		cerr << "Usage : " << Name
+			 << " [--json] [--filter Name] [--min-time Seconds]" << endl;
+		exit (1);
+	} // Usage
+
+} // namespace
+
+int main (int argc, char * argv [])
+{
+	bool   Json    = false;
+	string Filter;
+	double MinTime = 0.05; // secondes par mesure
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const string Arg = argv [i];
+		if (Arg == "--json")
+			Json = true;
+		else if (Arg == "--filter" && i + 1 < argc)
+			Filter = argv [++i];
+		else if (Arg == "--min-time" && i + 1 < argc)
+			MinTime = atof (argv [++i]);
+		else
+			Usage (argv [0]);
+	}
+
+	vector <CResult> Results;
+	for (unsigned s = 0; s < sizeof (KSizes) / sizeof (KSizes [0]); ++s)
+		for (unsigned c = 0; c < sizeof (KNbCandies) / sizeof (KNbCandies [0]);
+			 ++c)
+		{
+			// Mêmes grilles pour toutes les mesures d'un cas
+			CCase Case = { KSizes [s], KNbCandies [c], CRandom (s * 16 + c) };
+			vector <CGrid> Grids (min (KNbGrids, max (1u, KCellsPerCase /
+												(Case.Size * Case.Size))));
+			for (unsigned i = 0; i < Grids.size (); ++i)
+				InitGrid (Grids [i], Case.Size, Case.NbCandies, Case.Rng);
+
+			for (unsigned b = 0; b < sizeof (KBenches) / sizeof (KBenches [0]);
+				 ++b)
+			{
+				if (!Filter.empty () &&
+					string (KBenches [b].Name).find (Filter) == string::npos)
+					continue;
+				if (KBenches [b].RowScan >= 0 &&
+					!IsRowScanSupported (CRowScan (KBenches [b].RowScan)))
+					continue;
+				CResult Result;
+				Result.Name      = KBenches [b].Name;
+				Result.Size      = Case.Size;
+				Result.NbCandies = Case.NbCandies;
+				Result.Ns = Measure (KBenches [b], Grids, Case, Result.NbOps,
+									 MinTime);
+				Results.push_back (Result);
+			}
+		}
+
+	if (Json)
+		PrintJson (Results, MinTime);
+	else
+		PrintTable (Results);
+
+	return 0;
+} // main
@@ -0,0 +1,117 @@
+/**
+*
+* @file BenchHint.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Temps de réponse de l'indice sur les grilles du jeu, comparé au
+*        budget de KHintBudget microsecondes
+*
+* cmake --build build --target BenchHint && build/BenchHint
+*
+* Des parties de chaque difficulté sont jouées en suivant l'indice, avec
+*  le moteur du jeu (même profondeur, même budget, même table gardée d'un
+*  coup à l'autre) ; chaque question est chronométrée.
+*
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+#include "Engine.h"
+#include "Hint.h"
+
+using namespace std;
+using namespace nsNumberCrush;
+
+namespace
+{
+	typedef chrono::steady_clock CClock;
+
+	const char * KLevels [] = { "Easy", "Medium", "Hard" };
+	const unsigned KNbGames = 200; // parties par difficulté
+
+/**
+ * \fn void PlayGames (const std::string & Level,
+ *  std::vector <double> & Times, std::vector <unsigned> & Depths)
+ * \brief Play KNbGames games of Level, the hinted move each time
+ * \param Times Microseconds of each query
+ * \param Depths Number of queries answered at each depth
+ *
+ */
+	void PlayGames (const string & Level, vector <double> & Times,
+					vector <unsigned> & Depths)
+	{
+		CDifficulty Params;
+		GetDifficulty (Level, Params);
+		CHintEngine Hints;
+		Depths.assign (KHintDepth + 1, 0);
+		for (unsigned Seed = 1; Seed <= KNbGames; ++Seed)
+		{
+			CGame Game;
+			InitGame (Game, Params, Seed);
+			Resolve (Game);
+			for (CHint Hint; Game.NbMove > 0;)
+			{
+				const CClock::time_point Debut = CClock::now ();
+				const bool Found = Hints.FindHint (Game.Grid, Hint);
+				Times.push_back (chrono::duration <double, micro> (
+									 CClock::now () - Debut).count ());
+				if (!Found) break;
+				++Depths [Hint.Depth];
+				ApplyMove (Game, Hint.Move.Pos, Hint.Move.Direction);
+				Resolve (Game);
+			}
+		}
+	} // PlayGames
+
+} // namespace
+
+int main ()
+{
+	cout << "Budget : " << KHintBudget << " us, depth " << KHintDepth
+		 << ", " << KNbGames << " games per level" << endl
+		 << setw (8)  << "Level"   << setw (9) << "queries"
+		 << setw (10) << "mean us" << setw (9) << "p50"
+		 << setw (9)  << "p99"     << setw (9) << "max"
+		 << setw (8)  << "over"    << "  depths" << endl;
+
+	for (unsigned l = 0; l < sizeof (KLevels) / sizeof (KLevels [0]); ++l)
+	{
+		vector <double>   Times;
+		vector <unsigned> Depths;
+		PlayGames (KLevels [l], Times, Depths);
+		sort (Times.begin (), Times.end ());
+
+		double Sum = 0;
+		unsigned NbOver = 0;
+		for (unsigned i = 0; i < Times.size (); ++i)
+		{
+			Sum += Times [i];
+			NbOver += Times [i] > KHintBudget;
+		}
+		const size_t Last = Times.size () - 1;
+
+		cout << setw (8) << KLevels [l] << setw (9) << Times.size ()
+			 << fixed << setprecision (0)
+			 << setw (10) << Sum / Times.size ()
+			 << setw (9)  << Times [Last / 2]
+			 << setw (9)  << Times [Last * 99 / 100]
+			 << setw (9)  << Times [Last] << setw (8) << NbOver << ' ';
+		for (unsigned d = 1; d < Depths.size (); ++d)
+			cout << ' ' << d << ':' << Depths [d];
+		cout << endl;
+	}
+	cout << "(over : queries longer than the budget ; depths : how many"
+			" answers came" << endl
+		 << " from a search of that depth, the deepest finished in time)"
+		 << endl;
+
+	return 0;
+} // main
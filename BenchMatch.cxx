@@ -0,0 +1,170 @@
+/**
+*
+* @file BenchMatch.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Temps de FindMatches, et de la suppression de tous les
+*        alignements d'une grille, ligne par ligne ou par FindMatches
+*
+* cmake --build build --target BenchMatch && build/BenchMatch
+*
+* Même travail des deux côtés : une copie de la grille est vidée de tous
+*  ses alignements jusqu'à stabilité, soit ligne par ligne comme le
+*  faisait NumberCrushV1 (AtLeastThreeInARow puis AtLeastThreeInAColumn,
+*  chaque suite supprimée aussitôt), soit par Resolve, qui cherche avec
+*  FindMatches. La recherche seule est aussi mesurée sur les deux vues des
+*  colonnes de la grille : la copie par colonnes et les plans de bits.
+*
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+
+#include "Engine.h"
+
+using namespace std;
+using namespace nsNumberCrush;
+
+namespace
+{
+	typedef chrono::steady_clock CClock;
+
+	const unsigned KSizes []  = { 10, 16, 32, 64, 128, 256 };
+	const unsigned KNbCandies = 6;
+	const unsigned KNbGrids   = 16;
+	const double   KMinTime   = 0.2; // secondes par mesure
+
+/**
+ * \fn unsigned ClearLines (const CGrid & Grid)
+ * \brief What NumberCrushV1 does after each move, on a copy of Grid : the
+ *  first alignment of every line is removed until the line has none, then
+ *  the same for every column, and again until a whole pass removes
+ *  nothing
+ * \return The score of the removed alignments
+ *
+ */
+	unsigned ClearLines (const CGrid & Grid)
+	{
+		static CGrid Work;
+		Work = Grid;
+		unsigned Score = 0;
+		unsigned HowMany;
+		CPosition Pos;
+		for (bool Removed = true; Removed; )
+		{
+			Removed = false;
+			for (unsigned i = 0; i < Work.GetNbRows (); ++i)
+				for (Pos = make_pair (i, 0);
+					 AtLeastThreeInARow (Work, Pos, HowMany); Removed = true)
+				{
+					CalculScore (Score, HowMany);
+					RemovalInRow (Work, Pos, HowMany);
+				}
+			if (FullColumn (Work, Pos)) RemovalFullColumn (Work, Pos);
+			for (unsigned i = 0; i < Work.GetNbCols (); ++i)
+				for (Pos = make_pair (0, i);
+					 AtLeastThreeInAColumn (Work, Pos, HowMany);
+					 Removed = true)
+				{
+					CalculScore (Score, HowMany);
+					RemovalInColumn (Work, Pos, HowMany);
+				}
+		}
+		return Score;
+	} // ClearLines
+
+	// La même chose par Resolve, toutes les suites d'un tour à la fois
+	unsigned ClearMatches (const CGrid & Grid)
+	{
+		static CGrid Work;
+		Work = Grid;
+		unsigned Score = 0;
+		Resolve (Work, Score);
+		return Score;
+	} // ClearMatches
+
+	unsigned ScanMatches (const CGrid & Grid)
+	{
+		static vector <CRun> Runs;
+		FindMatches (Grid, Runs);
+		return Runs.size ();
+	} // ScanMatches
+
+/**
+ * \fn double Measure (const vector <CGrid> & Grids,
+ *  unsigned (*Scan) (const CGrid &), unsigned & Total)
+ * \brief Average time of one scan, in nanoseconds
+ * \param Total Sum of what Scan returns for each grid
+ *
+ */
+	double Measure (const vector <CGrid> & Grids,
+					unsigned (*Scan) (const CGrid &), unsigned & Total)
+	{
+		Total = 0;
+		for (unsigned i = 0; i < Grids.size (); ++i)
+			Total += Scan (Grids [i]);
+
+		unsigned long long NbScans = 0;
+		volatile unsigned Sink = 0;
+		const CClock::time_point Debut = CClock::now ();
+		double Ecart = 0;
+		for (; Ecart < KMinTime;
+			 Ecart = chrono::duration <double> (CClock::now () - Debut)
+						.count ())
+			for (unsigned i = 0; i < Grids.size (); ++i, ++NbScans)
+				Sink = Sink + Scan (Grids [i]);
+		return Ecart * 1e9 / NbScans;
+	} // Measure
+
+} // namespace
+
+int main ()
+{
+	CRandom Rng (0);
+	cout << setw (8)  << "Size"
+		 << setw (14) << "Lines (ns)" << setw (14) << "Resolve (ns)"
+		 << setw (8)  << "ratio"      << setw (14) << "Columns (ns)"
+		 << setw (13) << "Planes (ns)" << setw (7) << "runs" << endl;
+
+	for (unsigned s = 0; s < sizeof (KSizes) / sizeof (KSizes [0]); ++s)
+	{
+		vector <CGrid> Grids (KNbGrids), Planes (KNbGrids);
+		for (unsigned i = 0; i < KNbGrids; ++i)
+		{
+			InitGrid (Grids [i], KSizes [s], KNbCandies, Rng);
+			Planes [i] = Grids [i];
+			Planes [i].KeepColumns (false);
+		}
+
+		unsigned ScoreLines, ScoreMatches, NbRuns, NbPlaneRuns;
+		const double Lines   = Measure (Grids, ClearLines, ScoreLines);
+		const double Matches = Measure (Grids, ClearMatches, ScoreMatches);
+		const double Columns = Measure (Grids, ScanMatches, NbRuns);
+		const double Bits    = Measure (Planes, ScanMatches, NbPlaneRuns);
+		if (NbRuns != NbPlaneRuns)
+		{
+			cerr << "The planes find " << NbPlaneRuns << " alignments, the"
+					" columns " << NbRuns << endl;
+			return 1;
+		}
+
+		cout << setw (5) << KSizes [s] << 'x' << setw (3) << left
+			 << KSizes [s] << right << fixed << setprecision (0)
+			 << setw (14) << Lines << setw (14) << Matches
+			 << setprecision (1) << setw (7) << Lines / Matches << 'x'
+			 << setprecision (0) << setw (14) << Columns
+			 << setw (13) << Bits << setw (7) << NbRuns / KNbGrids << endl;
+	}
+	cout << "(Lines and Resolve both clear every alignment of a copy of the"
+			" grid until" << endl
+		 << " none is left, ratio = Lines / Resolve ; Columns and Planes"
+			" only find them," << endl
+		 << " runs per grid, on each view of the columns)" << endl;
+
+	return 0;
+} // main
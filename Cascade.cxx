@@ -0,0 +1,137 @@
+/**
+*
+* @file Cascade.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Suppression des alignements en chaîne jusqu'à stabilité
+*
+*/
+
+#include "Cascade.h"
+#include "Counters.h"
+#include "Match.h"
+#include "Gravity.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		// Vide les cases des alignements, puis tasse les colonnes touchées
+		void RemoveRuns (CGrid & Grid, const vector <CRun> & Runs,
+						 CCascadeStep & Step, CLineMask & Emptied,
+						 vector <CPosition> & Changed)
+		{
+			NC_STAGE (KStageRemoval);
+			ResetLineMask (Emptied, Grid.GetNbCols ());
+			for (unsigned i = 0; i < Runs.size (); ++i)
+			{
+				const CRun & Run = Runs [i];
+				CalculScore (Step.Points, Run.Length);
+				const unsigned DRow = Run.Vertical ? 1 : 0;
+				const unsigned DCol = Run.Vertical ? 0 : 1;
+				for (unsigned k = 0; k < Run.Length; ++k)
+				{
+					const unsigned Row = Run.Pos.first  + k * DRow;
+					const unsigned Col = Run.Pos.second + k * DCol;
+					// Case au croisement de deux alignements : déjà vide
+					if (0 == Grid (Row, Col)) continue;
+					Grid.Set (Row, Col, 0);
+					MarkLine (Emptied, Col);
+					++Step.NbCleared;
+				}
+			}
+			NC_COUNT (KStageRemoval, Step.NbCleared);
+
+			Changed.clear ();
+			for (unsigned Word = 0; Word < Emptied.size (); ++Word)
+				for (CWord Bits = Emptied [Word]; Bits; Bits &= Bits - 1)
+					CollapseColumn (Grid, Word * KBitsPerWord +
+										  __builtin_ctzll (Bits), &Changed);
+		} // RemoveRuns
+
+/**
+ * \fn void Cascade (CGrid & Grid, unsigned & Score, CCascadeStats & Stats,
+ *  const vector <CPosition> * Dirty)
+ * \brief Resolve, from the whole grid if Dirty is null
+ *
+ */
+		void Cascade (CGrid & Grid, unsigned & Score, CCascadeStats & Stats,
+					  const vector <CPosition> * Dirty)
+		{
+			Stats.Steps.clear ();
+			Stats.NbRuns = Stats.NbCleared = Stats.Points = 0;
+
+			static thread_local vector <CRun>      Runs;
+			static thread_local vector <CPosition> Changed;
+			static thread_local CLineMask Emptied;
+
+			for (bool First = true; ; First = false)
+			{
+				CCascadeStep Step;
+				if (First && !Dirty)
+				{
+					Step.NbLines = Grid.GetNbRows () + Grid.GetNbCols ();
+					FindMatches (Grid, Runs);
+				}
+				else
+					// Tours suivants : autour des cases modifiées seulement
+					Step.NbLines = FindMatches (Grid, First ? *Dirty : Changed,
+												Runs);
+				if (Runs.empty ()) break;
+
+				Step.NbRuns    = Runs.size ();
+				Step.NbCleared = 0;
+				Step.Points    = 0;
+				RemoveRuns (Grid, Runs, Step, Emptied, Changed);
+				CollapseEmptyColumns (Grid, &Changed);
+
+				Score += Step.Points;
+				Stats.NbRuns    += Step.NbRuns;
+				Stats.NbCleared += Step.NbCleared;
+				Stats.Points    += Step.Points;
+				Stats.Steps.push_back (Step);
+			}
+		} // Cascade
+
+	} // namespace
+
+	void CalculScore (unsigned & Score, unsigned HowMany)
+	{
+		if (HowMany == 3)
+			Score = Score + 3;
+		else if (HowMany == 4)
+			Score = Score + 6;
+		else if (HowMany >= 5)
+			Score = Score + 9;
+	} // CalculScore
+
+	void Resolve (CGrid & Grid, unsigned & Score, CCascadeStats & Stats)
+	{
+		Cascade (Grid, Score, Stats, 0);
+	} // Resolve
+
+	void Resolve (CGrid & Grid, unsigned & Score, CCascadeStats & Stats,
+				  const vector <CPosition> & Dirty)
+	{
+		Cascade (Grid, Score, Stats, &Dirty);
+	} // Resolve
+
+	void Resolve (CGrid & Grid, unsigned & Score)
+	{
+		static thread_local CCascadeStats Stats;
+		Resolve (Grid, Score, Stats);
+	} // Resolve
+
+	void Resolve (CGrid & Grid, unsigned & Score,
+				  const vector <CPosition> & Dirty)
+	{
+		static thread_local CCascadeStats Stats;
+		Resolve (Grid, Score, Stats, Dirty);
+	} // Resolve
+
+} // namespace nsNumberCrush
@@ -0,0 +1,103 @@
+/**
+*
+* @file Cascade.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Suppression des alignements en chaîne jusqu'à stabilité
+*
+*/
+
+#ifndef __CASCADE_H__
+#define __CASCADE_H__
+
+#include <vector>
+
+#include "Grid.h"
+
+namespace nsNumberCrush
+{
+/**
+ * \struct CCascadeStep
+ * \brief What one round of the cascade did
+ *
+ */
+	struct CCascadeStep
+	{
+		unsigned NbRuns;    ///< Alignments removed
+		unsigned NbCleared; ///< Cells emptied (crossing alignments share one)
+		unsigned Points;    ///< Points earned
+		unsigned NbLines;   ///< Rows plus columns examined to find them
+	}; // CCascadeStep
+
+/**
+ * \struct CCascadeStats
+ * \brief Every round of a cascade, plus the totals
+ *
+ */
+	struct CCascadeStats
+	{
+		std::vector <CCascadeStep> Steps;
+		unsigned NbRuns;
+		unsigned NbCleared;
+		unsigned Points;
+	}; // CCascadeStats
+
+/**
+ * \fn void CalculScore (unsigned & Score, unsigned HowMany)
+ * \brief Calcul the player's score
+ * \param Score Current points earn by the player
+ * \param HowMany Represent the number of following elements
+ *  (at least three following numbers)
+ *
+ */
+	void CalculScore (unsigned & Score, unsigned HowMany);
+
+/**
+ * \fn void Resolve (CGrid & Grid, unsigned & Score, CCascadeStats & Stats)
+ * \brief Remove the alignments, collapse the grid and start again until
+ *  nothing is aligned anymore
+ * \param Grid The matrix
+ * \param Score Amount of points you have, increased with CalculScore
+ * \param Stats Overwritten with one step per round that removed something
+ *
+ * The first round examines the whole grid ; the following ones only the
+ *  surroundings of the cells changed by the previous collapse.
+ *
+ */
+	void Resolve (CGrid & Grid, unsigned & Score, CCascadeStats & Stats);
+
+/**
+ * \fn void Resolve (CGrid & Grid, unsigned & Score, CCascadeStats & Stats,
+ *  const std::vector <CPosition> & Dirty)
+ * \brief Same as Resolve, on a grid where nothing was aligned before the
+ *  cells of Dirty changed (the two cells of a swap, for instance)
+ *
+ * The first round only examines the surroundings of Dirty, in their rows
+ *  and columns : its cost depends on what changed, not on the grid size.
+ *
+ */
+	void Resolve (CGrid & Grid, unsigned & Score, CCascadeStats & Stats,
+				  const std::vector <CPosition> & Dirty);
+
+/**
+ * \fn void Resolve (CGrid & Grid, unsigned & Score)
+ * \brief Same as Resolve, without the statistics
+ *
+ */
+	void Resolve (CGrid & Grid, unsigned & Score);
+
+/**
+ * \fn void Resolve (CGrid & Grid, unsigned & Score,
+ *  const std::vector <CPosition> & Dirty)
+ * \brief Same as Resolve from Dirty, without the statistics
+ *
+ */
+	void Resolve (CGrid & Grid, unsigned & Score,
+				  const std::vector <CPosition> & Dirty);
+
+} // namespace nsNumberCrush
+
+#endif /* __CASCADE_H__ */
@@ -0,0 +1,80 @@
+/**
+*
+* @file Counters.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Compteurs des étapes d'un tour et résumé de fin de partie
+*
+*/
+
+#include <iomanip>
+
+#include "Counters.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		thread_local CStageCounters Counters [KNbStages];
+
+		const char * const KNames [KNbStages] =
+		{
+			"swap", "scan", "removal", "shift", "moves", "render", "wait"
+		};
+
+		const char * const KUnits [KNbStages] =
+		{
+			"swaps", "cells", "cells", "columns", "cells", "bytes", "answers"
+		};
+
+	} // namespace
+
+	CStageCounters * GetCounters ()
+	{
+		return Counters;
+	} // GetCounters
+
+	void ResetCounters ()
+	{
+		for (unsigned i = 0; i < KNbStages; ++i)
+			Counters [i].NbCalls = Counters [i].NbItems = Counters [i].Ns = 0;
+	} // ResetCounters
+
+	void PrintCounters (ostream & Os)
+	{
+		if (!KCountersEnabled) return;
+
+		// Un tour par échange joué, au moins un pour ne pas diviser par 0
+		const uint64_t NbTurns = Counters [KStageSwap].NbCalls
+								 ? Counters [KStageSwap].NbCalls : 1;
+		const ios::fmtflags Flags     = Os.flags ();
+		const streamsize    Precision = Os.precision ();
+
+		Os << endl << "Turns : " << Counters [KStageSwap].NbCalls << endl
+		   << left << setw (9) << "Stage" << right
+		   << setw (10) << "calls" << setw (14) << "items" << setw (9) << ""
+		   << setw (11) << "total ms" << setw (12) << "ms / turn"
+		   << setw (12) << "ns / call" << endl;
+		for (unsigned i = 0; i < KNbStages; ++i)
+		{
+			const CStageCounters & Stage = Counters [i];
+			Os << left << setw (9) << KNames [i] << right
+			   << setw (10) << Stage.NbCalls
+			   << setw (14) << Stage.NbItems << ' ' << left << setw (8)
+			   << KUnits [i] << right << fixed << setprecision (3)
+			   << setw (11) << Stage.Ns / 1e6
+			   << setw (12) << Stage.Ns / 1e6 / NbTurns
+			   << setprecision (0) << setw (12)
+			   << (Stage.NbCalls ? double (Stage.Ns) / Stage.NbCalls : 0.0)
+			   << endl;
+		}
+		Os.flags (Flags);
+		Os.precision (Precision);
+	} // PrintCounters
+
+} // namespace nsNumberCrush
@@ -0,0 +1,129 @@
+/**
+*
+* @file Counters.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Compteurs des étapes d'un tour (appels, cases, temps), absents
+*        du binaire sauf si NUMBERCRUSH_COUNTERS est défini
+*
+* Chaque thread a ses propres compteurs : le simulateur peut jouer sur
+*  tous les coeurs sans qu'ils se partagent une ligne de cache.
+*
+*/
+
+#ifndef __COUNTERS_H__
+#define __COUNTERS_H__
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace nsNumberCrush
+{
+/**
+ * \enum CStage
+ * \brief Where the time of a turn goes
+ *
+ */
+	enum CStage
+	{
+		KStageSwap,     ///< Move of the player : swaps
+		KStageScan,     ///< Alignment search : cells scanned
+		KStageRemoval,  ///< Alignments emptied, gravity : cells emptied
+		KStageShift,    ///< Empty columns moved to the right : columns
+		KStageMoves,    ///< Search of the remaining moves : cells
+		KStageRender,   ///< Grid sent to the terminal : bytes
+		KStageWait,     ///< Player thinking : answers read
+		KNbStages
+	}; // CStage
+
+/**
+ * \struct CStageCounters
+ * \brief Totals of one stage ; what NbItems counts depends on the stage
+ *
+ */
+	struct CStageCounters
+	{
+		std::uint64_t NbCalls;
+		std::uint64_t NbItems;
+		std::uint64_t Ns;
+	}; // CStageCounters
+
+#ifdef NUMBERCRUSH_COUNTERS
+	const bool KCountersEnabled = true;
+#else
+	const bool KCountersEnabled = false;
+#endif
+
+/**
+ * \fn CStageCounters * GetCounters ()
+ * \brief The KNbStages counters of the calling thread
+ *
+ */
+	CStageCounters * GetCounters ();
+
+/**
+ * \fn void ResetCounters ()
+ * \brief Set the counters of the calling thread back to 0, at the start
+ *  of a game
+ *
+ */
+	void ResetCounters ();
+
+/**
+ * \fn void PrintCounters (std::ostream & Os)
+ * \brief Summary of the game : calls, items and time of every stage,
+ *  in total and per turn (a turn being one swap). Prints nothing when
+ *  the counters are compiled out
+ *
+ */
+	void PrintCounters (std::ostream & Os);
+
+/**
+ * \class CStageTimer
+ * \brief Adds one call and the time spent between its construction and
+ *  its destruction to a stage
+ *
+ */
+	class CStageTimer
+	{
+		typedef std::chrono::steady_clock CClock;
+
+		CStageCounters &  m_Counters;
+		CClock::time_point m_Start;
+
+		CStageTimer (const CStageTimer &);
+		CStageTimer & operator = (const CStageTimer &);
+
+	  public :
+		explicit CStageTimer (CStage Stage)
+			: m_Counters (GetCounters () [Stage]), m_Start (CClock::now ())
+		{
+			++m_Counters.NbCalls;
+		}
+
+		~CStageTimer ()
+		{
+			m_Counters.Ns += std::chrono::duration_cast
+				<std::chrono::nanoseconds> (CClock::now () - m_Start).count ();
+		}
+
+	}; // CStageTimer
+
+} // namespace nsNumberCrush
+
+// Rien n'est compté, ni même appelé, sans NUMBERCRUSH_COUNTERS
+#ifdef NUMBERCRUSH_COUNTERS
+#define NC_STAGE(Stage) \
+	::nsNumberCrush::CStageTimer NcStageTimer (::nsNumberCrush::Stage)
+#define NC_COUNT(Stage, Nb) \
+	(::nsNumberCrush::GetCounters () [::nsNumberCrush::Stage].NbItems += (Nb))
+#else
+#define NC_STAGE(Stage)     ((void) 0)
+#define NC_COUNT(Stage, Nb) ((void) 0)
+#endif
+
+#endif /* __COUNTERS_H__ */
@@ -0,0 +1,134 @@
+/**
+*
+* @file Engine.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Moteur de NumberCrush, sans entrée ni sortie
+*
+*/
+
+#include <vector>
+
+#include "Counters.h"
+#include "Engine.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	void GetDifficulty (const string & Difficulty, CDifficulty & Params)
+	{
+		Params.Size = 10;
+		if (Difficulty == "Easy")
+		{
+			Params.NbCandies = 4;
+			Params.NbMove    = 40;
+			Params.TimeLimit = 120;
+			Params.Bonus     = 0;
+		}
+		else if (Difficulty == "Medium")
+		{
+			Params.NbCandies = 6;
+			Params.NbMove    = 35;
+			Params.TimeLimit = 120;
+			Params.Bonus     = 500;
+		}
+		else
+		{
+			Params.NbCandies = 8;
+			Params.NbMove    = 30;
+			Params.TimeLimit = 90;
+			Params.Bonus     = 1000;
+		}
+	} // GetDifficulty
+
+	unsigned GetLevel (const string & Difficulty)
+	{
+		return Difficulty == "Easy" ? 0 : Difficulty == "Medium" ? 1 : 2;
+	} // GetLevel
+
+	void InitGrid (CGrid & Grid, unsigned Size, unsigned NbCandies,
+				   CRandom & Rng)
+	{
+		Grid.Resize (Size, Size);
+		vector <CCell> Line (Grid.GetNbCols ());
+		for (unsigned i (0); i < Grid.GetNbRows (); ++i)
+		{
+			Rng.Fill (Line.data (), Line.size (), NbCandies);
+			for (unsigned j (0); j < Grid.GetNbCols (); ++j)
+				Grid.Set (i, j, Line [j]);
+		}
+	} // InitGrid
+
+	void InitGame (CGame & Game, const CDifficulty & Params, uint64_t Seed)
+	{
+		Game.Seed = Seed;
+		Game.Rng.SetSeed (Seed);
+		InitGrid (Game.Grid, Params.Size, Params.NbCandies, Game.Rng);
+		Game.NbCandies = Params.NbCandies;
+		Game.Score     = Params.Bonus;
+		Game.NbMove    = Params.NbMove;
+		Game.Cascade.Steps.clear ();
+		Game.Cascade.NbRuns = Game.Cascade.NbCleared = 0;
+		Game.Cascade.Points = 0;
+		Game.IsNew = true;
+		Game.Dirty.clear ();
+	} // InitGame
+
+	bool IsValidMove (const CGrid & Grid, const CPosition & Pos,
+					  char Direction)
+	{
+		CPosition Other;
+		return Pos.first < Grid.GetNbRows () &&
+			   Pos.second < Grid.GetNbCols () &&
+			   Neighbour (Grid, Pos, Direction, Other) &&
+			   Grid (Pos.first, Pos.second) != 0 &&
+			   Grid (Other.first, Other.second) != 0;
+	} // IsValidMove
+
+	bool ApplyMove (CGame & Game, const CPosition & Pos, char Direction)
+	{
+		if (!IsValidMove (Game.Grid, Pos, Direction)) return false;
+
+		NC_STAGE (KStageSwap);
+		NC_COUNT (KStageSwap, 1);
+		CPosition Other;
+		Neighbour (Game.Grid, Pos, Direction, Other);
+		Game.Grid.Swap (Pos, Other);
+		Game.Dirty.push_back (Pos);
+		Game.Dirty.push_back (Other);
+		if (Game.NbMove > 0) --Game.NbMove;
+		return true;
+	} // ApplyMove
+
+	void Resolve (CGame & Game)
+	{
+		if (Game.IsNew)
+			Resolve (Game.Grid, Game.Score, Game.Cascade);
+		else
+			Resolve (Game.Grid, Game.Score, Game.Cascade, Game.Dirty);
+		Game.IsNew = false;
+		Game.Dirty.clear ();
+	} // Resolve
+
+	bool IsOver (const CGame & Game)
+	{
+		return 0 == Game.NbMove || !AnyMove (Game.Grid);
+	} // IsOver
+
+	unsigned StandardScore (const CGame & Game, unsigned Ecart)
+	{
+		// Le dénominateur est nul si tous les coups sont joués en 10 s
+		const unsigned Div = Game.NbMove + Ecart / 10;
+		return (Game.Score * 10000) / (Div ? Div : 1);
+	} // StandardScore
+
+	unsigned ChronoScore (const CGame & Game, unsigned Ecart)
+	{
+		return (Game.Score * 1000) / (Ecart ? Ecart : 1);
+	} // ChronoScore
+
+} // namespace nsNumberCrush
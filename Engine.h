@@ -0,0 +1,161 @@
+/**
+*
+* @file Engine.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Moteur de NumberCrush, sans entrée ni sortie
+*
+* Seul en-tête à inclure pour jouer une partie sans terminal (simulation,
+*  tests de charge) : il regroupe la grille, la détection des alignements,
+*  le tassement, la recherche des déplacements et les cascades.
+*
+*/
+
+#ifndef __ENGINE_H__
+#define __ENGINE_H__
+
+#include <string>
+#include <vector>
+
+#include "Grid.h"
+#include "Match.h"
+#include "Gravity.h"
+#include "Moves.h"
+#include "Cascade.h"
+#include "Random.h"
+
+namespace nsNumberCrush
+{
+/**
+ * \struct CDifficulty
+ * \brief Parameters of a game for one difficulty
+ *
+ */
+	struct CDifficulty
+	{
+		unsigned Size;      ///< Number of lines and of columns
+		unsigned NbCandies; ///< Amount of different numbers
+		unsigned NbMove;    ///< Moves allowed in standard mode
+		int      TimeLimit; ///< Seconds allowed in chrono mode
+		unsigned Bonus;     ///< Points given at the start of the game
+	}; // CDifficulty
+
+/**
+ * \struct CGame
+ * \brief State of a game in progress
+ *
+ */
+	struct CGame
+	{
+		CGrid         Grid;
+		unsigned      NbCandies;
+		unsigned      Score;
+		unsigned      NbMove;   ///< Moves left
+		CCascadeStats Cascade;  ///< What the last Resolve did
+		bool          IsNew;    ///< Never resolved : Resolve reads it all
+		std::vector <CPosition> Dirty; ///< Cells swapped since then
+		std::uint64_t Seed;     ///< Seed the game was started with
+		CRandom       Rng;      ///< Random numbers of this game only
+	}; // CGame
+
+/**
+ * \fn void GetDifficulty (const std::string & Difficulty,
+ *  CDifficulty & Params)
+ * \brief Parameters for "Easy", "Medium" or anything else (hard)
+ *
+ */
+	void GetDifficulty (const std::string & Difficulty,
+						CDifficulty & Params);
+
+	const unsigned KNbLevels = 3; ///< Easy, Medium, hard
+
+/**
+ * \fn unsigned GetLevel (const std::string & Difficulty)
+ * \brief 0 for "Easy", 1 for "Medium", 2 for anything else, as
+ *  GetDifficulty
+ *
+ */
+	unsigned GetLevel (const std::string & Difficulty);
+
+/**
+ * \fn void InitGrid (CGrid & Grid, unsigned Size, unsigned NbCandies,
+ *  CRandom & Rng)
+ * \brief Initialize the Grid with random numbers
+ * \param Grid The matrix
+ * \param Size The size of the matrix
+ * \param NbCandies The amount of candies, represented by numbers
+ * \param Rng The generator the numbers are drawn from
+ *
+ */
+	void InitGrid (CGrid & Grid, unsigned Size, unsigned NbCandies,
+				   CRandom & Rng);
+
+/**
+ * \fn void InitGame (CGame & Game, const CDifficulty & Params,
+ *  std::uint64_t Seed)
+ * \brief Start a game : random grid, bonus points, moves allowed
+ * \param Seed The same seed always gives the same grid
+ *
+ */
+	void InitGame (CGame & Game, const CDifficulty & Params,
+				   std::uint64_t Seed);
+
+/**
+ * \fn bool IsValidMove (const CGrid & Grid, const CPosition & Pos,
+ *  char Direction)
+ * \brief Return true if Pos and its neighbour in Direction are two
+ *  numbers of the grid, whatever the swap aligns
+ *
+ */
+	bool IsValidMove (const CGrid & Grid, const CPosition & Pos,
+					  char Direction);
+
+/**
+ * \fn bool ApplyMove (CGame & Game, const CPosition & Pos, char Direction)
+ * \brief Swap Pos with its neighbour in Direction and use up one move ;
+ *  both cells are added to Game.Dirty
+ * \return false, leaving the game unchanged, if the move is not valid
+ *
+ */
+	bool ApplyMove (CGame & Game, const CPosition & Pos, char Direction);
+
+/**
+ * \fn void Resolve (CGame & Game)
+ * \brief Resolve the cascades of the grid, adding the points to the score
+ *  and the statistics to Game.Cascade
+ *
+ * Only the surroundings of Game.Dirty are searched, unless the grid is
+ *  new ; Game.Dirty is then emptied.
+ *
+ */
+	void Resolve (CGame & Game);
+
+/**
+ * \fn bool IsOver (const CGame & Game)
+ * \brief Return true when no move is left or none aligns anything
+ *
+ */
+	bool IsOver (const CGame & Game);
+
+/**
+ * \fn unsigned StandardScore (const CGame & Game, unsigned Ecart)
+ * \brief Final score in standard mode
+ * \param Ecart Duration of the game in seconds
+ *
+ */
+	unsigned StandardScore (const CGame & Game, unsigned Ecart);
+
+/**
+ * \fn unsigned ChronoScore (const CGame & Game, unsigned Ecart)
+ * \brief Final score in chrono mode
+ * \param Ecart Duration of the game in seconds
+ *
+ */
+	unsigned ChronoScore (const CGame & Game, unsigned Ecart);
+
+} // namespace nsNumberCrush
+
+#endif /* __ENGINE_H__ */
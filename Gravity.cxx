@@ -0,0 +1,126 @@
+/**
+*
+* @file Gravity.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Tassement de la grille après la suppression de nombres
+*
+*/
+
+#include "Counters.h"
+#include "Gravity.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		inline void SetCell (CGrid & Grid, unsigned Row, unsigned Col,
+							 CCell Value, vector <CPosition> * Changed)
+		{
+			if (Grid (Row, Col) == Value) return;
+			Grid.Set (Row, Col, Value);
+			if (Changed) Changed->push_back (make_pair (Row, Col));
+		} // SetCell
+
+	} // namespace
+
+	void CollapseColumn (CGrid & Grid, unsigned Col,
+						 vector <CPosition> * Changed)
+	{
+		unsigned Dest = 0;
+		if (Grid.HasColumns ())
+		{
+			// Lue d'un bloc ; les écritures (Dest <= Row) ne touchent que
+			//  des cases déjà lues
+			const CCell * Column = Grid.GetColumn (Col);
+			for (unsigned Row = 0; Row < Grid.GetNbRows (); ++Row)
+				if (Column [Row] != 0)
+					SetCell (Grid, Dest++, Col, Column [Row], Changed);
+		}
+		else
+			for (unsigned Row = 0; Row < Grid.GetNbRows (); ++Row)
+			{
+				const CCell Cell = Grid (Row, Col);
+				if (0 == Cell) continue;
+				SetCell (Grid, Dest++, Col, Cell, Changed);
+			}
+		for (; Dest < Grid.GetNbRows (); ++Dest)
+			SetCell (Grid, Dest, Col, 0, Changed);
+	} // CollapseColumn
+
+	void Collapse (CGrid & Grid, vector <CPosition> * Changed)
+	{
+		for (unsigned Col = 0; Col < Grid.GetNbCols (); ++Col)
+			CollapseColumn (Grid, Col, Changed);
+	} // Collapse
+
+	void CollapseEmptyColumns (CGrid & Grid, vector <CPosition> * Changed)
+	{
+		NC_STAGE (KStageShift);
+		NC_COUNT (KStageShift, Grid.GetNbCols ());
+		if (0 == Grid.GetNbRows ()) return;
+
+		unsigned Dest = 0;
+		for (unsigned Col = 0; Col < Grid.GetNbCols (); ++Col)
+		{
+			// Une colonne tassée est vide si sa première case l'est
+			if (0 == Grid (0, Col)) continue;
+			if (Dest != Col)
+				for (unsigned Row = 0; Row < Grid.GetNbRows (); ++Row)
+					SetCell (Grid, Row, Dest, Grid (Row, Col), Changed);
+			++Dest;
+		}
+		for (; Dest < Grid.GetNbCols (); ++Dest)
+			for (unsigned Row = 0; Row < Grid.GetNbRows (); ++Row)
+				SetCell (Grid, Row, Dest, 0, Changed);
+	} // CollapseEmptyColumns
+
+	void RemovalInColumn (CGrid & Grid, const CPosition & Pos,
+						  unsigned  HowMany)
+	{
+		for (unsigned i = 0; i < HowMany; ++i)
+			Grid.Set (Pos.first + i, Pos.second, 0);
+		CollapseColumn (Grid, Pos.second);
+	} // RemovalInColumn
+
+	void RemovalInRow (CGrid & Grid, const CPosition & Pos,
+					   unsigned  HowMany)
+	{
+		for (unsigned j = Pos.second; j < Pos.second + HowMany; ++j)
+		{
+			Grid.Set (Pos.first, j, 0);
+			CollapseColumn (Grid, j);
+		}
+	} // RemovalInRow
+
+	bool FullColumn (CGrid & Grid, CPosition & Pos)
+	{
+		for (unsigned i = 0; i < Grid.GetNbCols (); ++i)
+			if (Grid (0, i) == 0)
+			{
+				Pos = make_pair (0, i);
+				return true;
+			}
+		return false;
+	} // FullColumn
+
+	void RemovalFullColumn (CGrid & Grid, const CPosition & Pos)
+	{
+		NC_STAGE (KStageShift);
+		NC_COUNT (KStageShift, Grid.GetNbCols () - Pos.second);
+		const unsigned Last = Grid.GetNbCols () - 1;
+		for (unsigned k = 0; k < Grid.GetNbRows (); ++k)
+		{
+			const CCell Cell = Grid (k, Pos.second);
+			for (unsigned i = Pos.second; i < Last; ++i)
+				Grid.Set (k, i, Grid (k, i + 1));
+			Grid.Set (k, Last, Cell);
+		}
+	} // RemovalFullColumn
+
+} // namespace nsNumberCrush
@@ -0,0 +1,104 @@
+/**
+*
+* @file Gravity.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Tassement de la grille après la suppression de nombres
+*
+*/
+
+#ifndef __GRAVITY_H__
+#define __GRAVITY_H__
+
+#include <vector>
+
+#include "Grid.h"
+
+namespace nsNumberCrush
+{
+/**
+ * \fn void CollapseColumn (CGrid & Grid, unsigned Col,
+ *  std::vector <CPosition> * Changed = 0)
+ * \brief Move the numbers of a column to the top, keeping their order,
+ *  and the zeros to the bottom, in a single pass
+ * \param Grid The matrix
+ * \param Col Index of the column
+ * \param Changed If not null, every modified cell is appended to it
+ *
+ */
+	void CollapseColumn (CGrid & Grid, unsigned Col,
+						 std::vector <CPosition> * Changed = 0);
+
+/**
+ * \fn void Collapse (CGrid & Grid, std::vector <CPosition> * Changed = 0)
+ * \brief CollapseColumn on every column of the grid
+ *
+ */
+	void Collapse (CGrid & Grid, std::vector <CPosition> * Changed = 0);
+
+/**
+ * \fn void CollapseEmptyColumns (CGrid & Grid,
+ *  std::vector <CPosition> * Changed = 0)
+ * \brief Move every empty column to the right, keeping the order of the
+ *  others, in a single pass
+ * \param Grid The matrix, whose columns must already be collapsed
+ * \param Changed If not null, every modified cell is appended to it
+ *
+ */
+	void CollapseEmptyColumns (CGrid & Grid,
+							   std::vector <CPosition> * Changed = 0);
+
+/**
+ * \fn void RemovalInColumn (CGrid & Grid, const CPosition & Pos,
+ * 							 unsigned  HowMany)
+ * \brief When at least three same numbers are in a column
+ * \param Grid The matrix
+ * \param Pos It's a pair of unsigned numbers, represent the position of
+ *  number you want to move
+ * \param HowMany Represent the number of consecutive elements
+ *  (at least three consecutive numbers)
+ *
+ */
+	void RemovalInColumn (CGrid & Grid, const CPosition & Pos,
+						  unsigned  HowMany);
+
+/**
+ * \fn void RemovalInRow (CGrid & Grid, const CPosition & Pos,
+ * 						  unsigned  HowMany)
+ * \brief When at least three same numbers are in a row
+ * \param Grid The matrix
+ * \param Pos It's a pair of unsigned numbers, represent the position of
+ *  number you want to move
+ * \param HowMany Represent the number of consecutive elements
+ *  (at least three consecutive numbers)
+ *
+ */
+	void RemovalInRow (CGrid & Grid, const CPosition & Pos,
+					   unsigned HowMany);
+
+/**
+ * \fn bool FullColumn (CGrid & Grid, CPosition & Pos)
+ * \brief Return true if a column is full of zeros
+ * \param Grid The matrix
+ * \param Pos It's a pair of unsigned numbers, represent the position of
+ *  number you want to move
+ *
+ */
+	bool FullColumn (CGrid & Grid, CPosition & Pos);
+
+/**
+ * \fn void RemovalFullColumn (CGrid & Grid, const CPosition & Pos)
+ * \brief Move to the right the full column
+ * \param Grid The matrix
+ * \param Pos It's a pair of unsigned numbers, represent the position of
+ *  number you want to move
+ *
+ */
+	void RemovalFullColumn (CGrid & Grid, const CPosition & Pos);
+
+} // namespace nsNumberCrush
+
+#endif /* __GRAVITY_H__ */
@@ -0,0 +1,74 @@
+/**
+*
+* @file Grid.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Grille de jeu contiguë doublée de ses colonnes, ou de plans de
+*        bits par bonbon
+*
+*/
+
+#include "Grid.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	CGrid::CGrid ()
+		: m_NbRows (0), m_NbCols (0), m_NbWords (0), m_HasColumns (true) {}
+
+	CGrid::CGrid (unsigned Size)
+		: m_NbRows (0), m_NbCols (0), m_NbWords (0), m_HasColumns (true)
+	{
+		Resize (Size, Size);
+	} // CGrid
+
+	CGrid::CGrid (unsigned NbRows, unsigned NbCols)
+		: m_NbRows (0), m_NbCols (0), m_NbWords (0), m_HasColumns (true)
+	{
+		Resize (NbRows, NbCols);
+	} // CGrid
+
+	void CGrid::Resize (unsigned NbRows, unsigned NbCols)
+	{
+		m_NbRows  = NbRows;
+		m_NbCols  = NbCols;
+		m_NbWords = (NbCols + KBitsPerWord - 1) / KBitsPerWord;
+		m_Cells.assign (NbRows * NbCols, 0);
+		BuildView ();
+	} // Resize
+
+	// Les colonnes ou les plans, refaits depuis les cases ; l'autre vue
+	//  est libérée
+	void CGrid::BuildView ()
+	{
+		if (m_HasColumns)
+		{
+			vector <CWord> ().swap (m_Planes);
+			m_Columns.resize (m_NbRows * m_NbCols);
+			for (unsigned Row = 0; Row < m_NbRows; ++Row)
+				for (unsigned Col = 0; Col < m_NbCols; ++Col)
+					m_Columns [Col * m_NbRows + Row] = (*this) (Row, Col);
+			return;
+		}
+		vector <CCell> ().swap (m_Columns);
+		m_Planes.assign ((KMaxCandies + 1) * m_NbRows * m_NbWords, 0);
+		const unsigned PlaneSize = m_NbRows * m_NbWords;
+		for (unsigned Row = 0; Row < m_NbRows; ++Row)
+			for (unsigned Col = 0; Col < m_NbCols; ++Col)
+				m_Planes [(*this) (Row, Col) * PlaneSize + Row * m_NbWords +
+						  Col / KBitsPerWord] |=
+					CWord (1) << (Col % KBitsPerWord);
+	} // BuildView
+
+	void CGrid::KeepColumns (bool Keep)
+	{
+		if (Keep == m_HasColumns) return;
+		m_HasColumns = Keep;
+		BuildView ();
+	} // KeepColumns
+
+} // namespace nsNumberCrush
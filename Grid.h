@@ -0,0 +1,195 @@
+/**
+*
+* @file Grid.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Grille de jeu contiguë doublée de ses colonnes, ou de plans de
+*        bits par bonbon
+*
+*/
+
+#ifndef __GRID_H__
+#define __GRID_H__
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cassert>
+
+/**
+ *
+ * \namespace nsNumberCrush
+ * \brief Game engine shared by every game mode
+ *
+ */
+namespace nsNumberCrush
+{
+/**
+ * \typedef CPosition
+ * \brief Spot of a number in the grid (line, column)
+ *
+ */
+	typedef std::pair <unsigned, unsigned> CPosition;
+
+/**
+ * \typedef CCell
+ * \brief Content of a cell : 0 when empty, else the candy's number
+ *
+ */
+	typedef unsigned char CCell;
+
+/**
+ * \typedef CWord
+ * \brief Block of 64 consecutive cells of a bitboard line
+ *
+ */
+	typedef std::uint64_t CWord;
+
+	const unsigned KMaxCandies  = 8;
+	const unsigned KBitsPerWord = 64;
+
+/**
+ * \class CGrid
+ * \brief Game grid stored line after line in a single buffer
+ *
+ * A second view of the cells serves the vertical scans. By default it is
+ *  a column-major copy, so that vertical scans and gravity read
+ *  consecutive bytes. Once KeepColumns (false) is called, every candy (and
+ *  the empty value 0) owns a bitboard plane instead : bit Col of line Row
+ *  in plane Candy is set when the cell holds Candy. Only one of the two
+ *  is kept, and copied with the grid.
+ *  Cells must only be written through Set () or Swap () so that this view
+ *  stays in sync with the buffer.
+ *
+ */
+	class CGrid
+	{
+		unsigned             m_NbRows;
+		unsigned             m_NbCols;
+		unsigned             m_NbWords;
+		std::vector <CCell>  m_Cells;
+		bool                 m_HasColumns;
+		std::vector <CCell>  m_Columns;  ///< Column after column, or empty
+		std::vector <CWord>  m_Planes;   ///< Empty while m_HasColumns
+
+		void BuildView ();
+
+	  public :
+		CGrid ();
+		explicit CGrid (unsigned Size);
+		CGrid (unsigned NbRows, unsigned NbCols);
+
+/**
+ * \fn void Resize (unsigned NbRows, unsigned NbCols)
+ * \brief Change the dimensions of the grid, every cell becomes empty
+ * \param NbRows Number of lines
+ * \param NbCols Number of columns
+ *
+ */
+		void Resize (unsigned NbRows, unsigned NbCols);
+
+		unsigned GetNbRows  () const { return m_NbRows;  }
+		unsigned GetNbCols  () const { return m_NbCols;  }
+		unsigned GetNbWords () const { return m_NbWords; }
+
+		CCell operator () (unsigned Row, unsigned Col) const
+		{
+			return m_Cells [Row * m_NbCols + Col];
+		}
+
+/**
+ * \fn const CCell * GetLine (unsigned Row) const
+ * \brief Return the m_NbCols contiguous cells of a line
+ *
+ */
+		const CCell * GetLine (unsigned Row) const
+		{
+			return &m_Cells [Row * m_NbCols];
+		}
+
+/**
+ * \fn const CWord * GetPlane (unsigned Candy, unsigned Row) const
+ * \brief Return the m_NbWords words of the bitboard of Candy for a line ;
+ *  only when !HasColumns ()
+ *
+ */
+		const CWord * GetPlane (unsigned Candy, unsigned Row) const
+		{
+			assert (!m_HasColumns);
+			return &m_Planes [(Candy * m_NbRows + Row) * m_NbWords];
+		}
+
+/**
+ * \fn void KeepColumns (bool Keep)
+ * \brief Keep the column-major copy (the default), or the bitboard planes
+ *  in its place
+ *
+ */
+		void KeepColumns (bool Keep);
+
+		bool HasColumns () const { return m_HasColumns; }
+
+/**
+ * \fn const CCell * GetColumn (unsigned Col) const
+ * \brief Return the m_NbRows contiguous cells of a column, from line 0 ;
+ *  only when HasColumns ()
+ *
+ */
+		const CCell * GetColumn (unsigned Col) const
+		{
+			assert (m_HasColumns);
+			return &m_Columns [Col * m_NbRows];
+		}
+
+		void Set (unsigned Row, unsigned Col, CCell Value);
+		void Swap (unsigned Row1, unsigned Col1,
+				   unsigned Row2, unsigned Col2);
+		void Swap (const CPosition & Pos1, const CPosition & Pos2)
+		{
+			Swap (Pos1.first, Pos1.second, Pos2.first, Pos2.second);
+		}
+
+		bool operator == (const CGrid & Other) const
+		{
+			return m_NbRows == Other.m_NbRows &&
+				   m_NbCols == Other.m_NbCols &&
+				   m_Cells  == Other.m_Cells;
+		}
+		bool operator != (const CGrid & Other) const
+		{
+			return !(*this == Other);
+		}
+
+	}; // CGrid
+
+	inline void CGrid::Set (unsigned Row, unsigned Col, CCell Value)
+	{
+		assert (Row < m_NbRows && Col < m_NbCols && Value <= KMaxCandies);
+		CCell & Cell = m_Cells [Row * m_NbCols + Col];
+		if (m_HasColumns)
+			m_Columns [Col * m_NbRows + Row] = Value;
+		else
+		{
+			const CWord    Bit  = CWord (1) << (Col % KBitsPerWord);
+			const unsigned Word = Row * m_NbWords + Col / KBitsPerWord;
+			const unsigned PlaneSize = m_NbRows * m_NbWords;
+			m_Planes [Cell  * PlaneSize + Word] &= ~Bit;
+			m_Planes [Value * PlaneSize + Word] |= Bit;
+		}
+		Cell = Value;
+	} // Set
+
+	inline void CGrid::Swap (unsigned Row1, unsigned Col1,
+							 unsigned Row2, unsigned Col2)
+	{
+		const CCell Tmp = (*this) (Row1, Col1);
+		Set (Row1, Col1, (*this) (Row2, Col2));
+		Set (Row2, Col2, Tmp);
+	} // Swap
+
+} // namespace nsNumberCrush
+
+#endif /* __GRID_H__ */
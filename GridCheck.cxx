@@ -0,0 +1,212 @@
+/**
+*
+* @file GridCheck.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Les deux vues des colonnes d'une grille (copie par colonnes, plans
+*        de bits) doivent donner les mêmes alignements et le même tassement
+*
+* grid-check
+*
+* Chaque grille tirée au hasard est copiée, la copie gardant ses plans de
+*  bits (KeepColumns (false)) ; toutes les recherches d'alignements, le
+*  tassement et les cascades sont faits sur les deux, qui doivent rester
+*  égales.
+*
+*/
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include "Engine.h"
+
+using namespace std;
+using namespace nsNumberCrush;
+
+namespace
+{
+	const unsigned KSizes []  = { 3, 5, 10, 17, 63, 64, 65, 130 };
+	const unsigned KNbDraws   = 8; // grilles par taille et nombre de bonbons
+	const unsigned KMaxSwaps  = 8; // échanges joués sur chaque grille
+
+	bool IsBefore (const CRun & Run1, const CRun & Run2)
+	{
+		if (Run1.Vertical != Run2.Vertical) return Run2.Vertical;
+		return Run1.Pos < Run2.Pos;
+	} // IsBefore
+
+	bool IsSame (const CRun & Run1, const CRun & Run2)
+	{
+		return Run1.Pos == Run2.Pos && Run1.Length == Run2.Length &&
+			   Run1.Vertical == Run2.Vertical && Run1.Candy == Run2.Candy;
+	} // IsSame
+
+	// Les deux vues ne rangent pas les colonnes dans le même ordre
+	bool IsSameRuns (vector <CRun> & Runs1, vector <CRun> & Runs2)
+	{
+		sort (Runs1.begin (), Runs1.end (), IsBefore);
+		sort (Runs2.begin (), Runs2.end (), IsBefore);
+		return Runs1.size () == Runs2.size () &&
+			   equal (Runs1.begin (), Runs1.end (), Runs2.begin (), IsSame);
+	} // IsSameRuns
+
+	// Les plans refaits depuis les cases, comparés à ceux tenus par Set
+	bool IsPlanesInSync (const CGrid & Grid)
+	{
+		CGrid Fresh (Grid);
+		Fresh.KeepColumns (true);
+		Fresh.KeepColumns (false);
+		for (unsigned Candy = 0; Candy <= KMaxCandies; ++Candy)
+			for (unsigned Row = 0; Row < Grid.GetNbRows (); ++Row)
+				if (!equal (Grid.GetPlane (Candy, Row),
+							Grid.GetPlane (Candy, Row) + Grid.GetNbWords (),
+							Fresh.GetPlane (Candy, Row)))
+					return false;
+		return true;
+	} // IsPlanesInSync
+
+	void RandomMask (CLineMask & Mask, unsigned NbLines, CRandom & Rng)
+	{
+		ResetLineMask (Mask, NbLines);
+		for (unsigned i = 0; i < NbLines; ++i)
+			if (Rng.Below (2)) MarkLine (Mask, i);
+	} // RandomMask
+
+/**
+ * \fn bool CheckGrid (CGrid & Columns, CRandom & Rng)
+ * \brief Compare every scan, the gravity and the cascades on Columns and
+ *  on its copy without the column-major view
+ * \return false, after telling what differs
+ *
+ */
+	bool CheckGrid (CGrid & Columns, CRandom & Rng)
+	{
+		CGrid Planes (Columns);
+		Planes.KeepColumns (false);
+		const unsigned NbRows = Columns.GetNbRows ();
+		const unsigned NbCols = Columns.GetNbCols ();
+
+		vector <CRun> Runs1, Runs2;
+		FindMatches (Columns, Runs1);
+		FindMatches (Planes, Runs2);
+		if (!IsSameRuns (Runs1, Runs2))
+		{
+			cerr << "FindMatches differs" << endl;
+			return false;
+		}
+
+		CLineMask Rows, Cols;
+		RandomMask (Rows, NbRows, Rng);
+		RandomMask (Cols, NbCols, Rng);
+		FindMatches (Columns, Rows, Cols, Runs1);
+		FindMatches (Planes, Rows, Cols, Runs2);
+		if (!IsSameRuns (Runs1, Runs2))
+		{
+			cerr << "FindMatches on lines differs" << endl;
+			return false;
+		}
+
+		for (unsigned Col = 0; Col < NbCols; ++Col)
+		{
+			CPosition Pos1 (0, Col), Pos2 (0, Col);
+			unsigned HowMany1, HowMany2;
+			const bool Found1 = AtLeastThreeInAColumn (Columns, Pos1,
+													   HowMany1);
+			const bool Found2 = AtLeastThreeInAColumn (Planes, Pos2,
+													   HowMany2);
+			if (Found1 != Found2 ||
+				(Found1 && (Pos1 != Pos2 || HowMany1 != HowMany2)))
+			{
+				cerr << "AtLeastThreeInAColumn differs on column " << Col
+					 << endl;
+				return false;
+			}
+		}
+
+		// Des trous un peu partout, puis la gravité
+		CGrid Holes1 (Columns), Holes2 (Planes);
+		for (unsigned i = 0; i < NbRows * NbCols / 4; ++i)
+		{
+			const unsigned Row = Rng.Below (NbRows);
+			const unsigned Col = Rng.Below (NbCols);
+			Holes1.Set (Row, Col, 0);
+			Holes2.Set (Row, Col, 0);
+		}
+		vector <CPosition> Changed1, Changed2;
+		Collapse (Holes1, &Changed1);
+		Collapse (Holes2, &Changed2);
+		if (Holes1 != Holes2 || Changed1 != Changed2)
+		{
+			cerr << "Collapse differs" << endl;
+			return false;
+		}
+
+		unsigned Score1 = 0, Score2 = 0;
+		Resolve (Columns, Score1);
+		Resolve (Planes, Score2);
+		if (Columns != Planes || Score1 != Score2)
+		{
+			cerr << "Resolve differs" << endl;
+			return false;
+		}
+
+		// Des échanges sur la grille stable, comme des coups joués
+		vector <CPosition> Swapped (2);
+		for (unsigned i = 0; i < KMaxSwaps && NbCols > 1; ++i)
+		{
+			Swapped [0] = CPosition (Rng.Below (NbRows),
+									 Rng.Below (NbCols - 1));
+			Swapped [1] = CPosition (Swapped [0].first,
+									 Swapped [0].second + 1);
+			Columns.Swap (Swapped [0], Swapped [1]);
+			Planes.Swap (Swapped [0], Swapped [1]);
+			FindMatches (Columns, Swapped, Runs1);
+			FindMatches (Planes, Swapped, Runs2);
+			if (!IsSameRuns (Runs1, Runs2))
+			{
+				cerr << "FindMatches around a swap differs" << endl;
+				return false;
+			}
+			Resolve (Columns, Score1, Swapped);
+			Resolve (Planes, Score2, Swapped);
+			if (Columns != Planes || Score1 != Score2)
+			{
+				cerr << "Resolve after a swap differs" << endl;
+				return false;
+			}
+		}
+
+		if (!IsPlanesInSync (Planes) || !IsPlanesInSync (Holes2))
+		{
+			cerr << "The planes are out of sync with the cells" << endl;
+			return false;
+		}
+		return true;
+	} // CheckGrid
+
+} // namespace
+
+int main ()
+{
+	CRandom Rng (42);
+	unsigned NbGrids = 0;
+	for (unsigned s = 0; s < sizeof (KSizes) / sizeof (KSizes [0]); ++s)
+		for (unsigned NbCandies = 2; NbCandies <= KMaxCandies; NbCandies *= 2)
+			for (unsigned Draw = 0; Draw < KNbDraws; ++Draw, ++NbGrids)
+			{
+				CGrid Grid;
+				InitGrid (Grid, KSizes [s], NbCandies, Rng);
+				if (!CheckGrid (Grid, Rng))
+				{
+					cerr << "on a " << KSizes [s] << 'x' << KSizes [s]
+						 << " grid of " << NbCandies << " candies" << endl;
+					return 1;
+				}
+			}
+	cout << NbGrids << " grids : the columns and the planes agree" << endl;
+	return 0;
+} // main
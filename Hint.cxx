@@ -0,0 +1,152 @@
+/**
+*
+* @file Hint.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Indice : le déplacement qui rapporte le plus (cascades comprises)
+*        sur les prochains coups, cherché en un temps borné
+*
+*/
+
+#include <cstring>
+
+#include "Cascade.h"
+#include "Hint.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		// Finaliseur de MurmurHash3 : chaque bit d'entrée touche tous les
+		//  bits de sortie
+		uint64_t Mix (uint64_t Value)
+		{
+			Value ^= Value >> 33;
+			Value *= 0xFF51AFD7ED558CCDULL;
+			Value ^= Value >> 33;
+			Value *= 0xC4CEB9FE1A85EC53ULL;
+			Value ^= Value >> 33;
+			return Value;
+		} // Mix
+
+	} // namespace
+
+	uint64_t HashGrid (const CGrid & Grid)
+	{
+		const unsigned Size = Grid.GetNbRows () * Grid.GetNbCols ();
+		uint64_t Hash = Mix (uint64_t (Grid.GetNbRows ()) << 32 |
+							 Grid.GetNbCols ());
+		if (0 == Size) return Hash;
+
+		// Les lignes se suivent : la grille est lue 8 cases à la fois
+		const CCell * Cells = Grid.GetLine (0);
+		unsigned i = 0;
+		for (uint64_t Word; i + sizeof (Word) <= Size; i += sizeof (Word))
+		{
+			memcpy (&Word, Cells + i, sizeof (Word));
+			Hash = Mix (Hash ^ Word);
+		}
+		uint64_t Tail = 0;
+		memcpy (&Tail, Cells + i, Size - i);
+		return Mix (Hash ^ Tail);
+	} // HashGrid
+
+	CHintEngine::CHintEngine (unsigned MaxDepth, unsigned Budget,
+							  unsigned TableBits)
+		: m_Table (size_t (1) << TableBits),
+		  m_Moves (MaxDepth ? MaxDepth + 1 : 2),
+		  m_Grids (m_Moves.size ()),
+		  m_Swapped (2),
+		  m_MaxDepth (MaxDepth ? MaxDepth : 1),
+		  m_Budget (Budget),
+		  m_IsTimed (false),
+		  m_IsStopped (false),
+		  m_NbNodes (0)
+	{
+		CEntry Empty;
+		memset (&Empty, 0, sizeof (Empty));
+		m_Table.assign (m_Table.size (), Empty);
+	} // CHintEngine
+
+	unsigned CHintEngine::Search (const CGrid & Grid, unsigned Depth,
+								  CMove * Best)
+	{
+		// Best n'est demandé qu'à la racine, que la table ne décrit pas
+		const uint64_t Key = HashGrid (Grid);
+		CEntry & Entry = m_Table [(Key ^ Depth) & (m_Table.size () - 1)];
+		if (!Best && Entry.Key == Key && Entry.Depth == Depth)
+			return Entry.Gain;
+
+		vector <CMove> & Moves = m_Moves [Depth];
+		FindMoves (Grid, Moves);
+
+		CGrid & Next = m_Grids [Depth];
+		unsigned Max = 0;
+		for (unsigned i = 0; i < Moves.size (); ++i)
+		{
+			// La racine voit au moins son premier déplacement : il y a
+			//  toujours une réponse
+			if (m_IsTimed && (i > 0 || !Best) && CClock::now () >= m_Deadline)
+				m_IsStopped = true;
+			if (m_IsStopped) break;
+			++m_NbNodes;
+
+			// Grid est stable : seules les cases échangées sont à revoir
+			Next = Grid;
+			m_Swapped [0] = Moves [i].Pos;
+			Neighbour (Next, m_Swapped [0], Moves [i].Direction,
+					   m_Swapped [1]);
+			Next.Swap (m_Swapped [0], m_Swapped [1]);
+
+			unsigned Gain = 0;
+			Resolve (Next, Gain, m_Swapped);
+			if (Depth > 1) Gain += Search (Next, Depth - 1, 0);
+
+			// A gain égal, le premier déplacement trouvé est gardé
+			if (Gain > Max || (0 == i))
+			{
+				Max = Gain;
+				if (Best) *Best = Moves [i];
+			}
+		}
+		// Une recherche interrompue sous-estime : elle n'est pas gardée,
+		//  seul le meilleur des déplacements vus sert, à la racine
+		if (m_IsStopped) return Max;
+
+		Entry.Key   = Key;
+		Entry.Gain  = Max;
+		Entry.Depth = Depth;
+		return Max;
+	} // Search
+
+	bool CHintEngine::FindHint (const CGrid & Grid, CHint & Hint)
+	{
+		if (!AnyMove (Grid)) return false;
+
+		m_Deadline  = CClock::now () + m_Budget;
+		m_IsStopped = false;
+		m_NbNodes   = 0;
+		m_IsTimed   = m_Budget.count () > 0;
+		for (unsigned Depth = 1; Depth <= m_MaxDepth; ++Depth)
+		{
+			CMove Move;
+			const unsigned Gain = Search (Grid, Depth, &Move);
+			if (m_IsStopped && Depth > 1) break;
+
+			// Même interrompue, la recherche gloutonne a vu des
+			//  déplacements entiers : le meilleur d'entre eux est gardé
+			Hint.Move  = Move;
+			Hint.Gain  = Gain;
+			Hint.Depth = Depth;
+			if (m_IsStopped) break;
+		}
+		Hint.NbNodes = m_NbNodes;
+		return true;
+	} // FindHint
+
+} // namespace nsNumberCrush
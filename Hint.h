@@ -0,0 +1,139 @@
+/**
+*
+* @file Hint.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Indice : le déplacement qui rapporte le plus (cascades comprises)
+*        sur les prochains coups, cherché en un temps borné
+*
+*/
+
+#ifndef __HINT_H__
+#define __HINT_H__
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "Grid.h"
+#include "Moves.h"
+
+namespace nsNumberCrush
+{
+	const unsigned KHintDepth  = 3;    ///< Moves looked ahead by default
+	const unsigned KHintBudget = 5000; ///< Microseconds per hint by default
+
+	// Réponse quand FindHint ne trouve rien, au clavier comme aux questions
+	const char KNoHintFr [] = "Aucun indice : aucun échange n'aligne rien";
+	const char KNoHintEn [] = "No hint : no swap aligns anything";
+
+	// Tables de transposition, en log2 du nombre de positions (16 octets
+	//  chacune) : 1 Mo pour le jeu, 256 Ko pour une politique, refaite à
+	//  chaque partie simulée
+	const unsigned KHintTableBits   = 16; ///< Log2 of the number of entries
+	const unsigned KPolicyTableBits = 14; ///< Same, for CHintPolicy
+
+/**
+ * \fn std::uint64_t HashGrid (const CGrid & Grid)
+ * \brief 64 bits summary of the size and of the cells of Grid ; two grids
+ *  with the same hash are the same but for a collision, about one chance
+ *  in 2^64
+ *
+ */
+	std::uint64_t HashGrid (const CGrid & Grid);
+
+/**
+ * \struct CHint
+ * \brief Answer of CHintEngine::FindHint
+ *
+ */
+	struct CHint
+	{
+		CMove    Move;
+		unsigned Gain;    ///< Points of Move and of the best moves after it
+		unsigned Depth;   ///< Moves looked ahead by the search kept
+		unsigned NbNodes; ///< Swaps played by the whole query
+	}; // CHint
+
+/**
+ * \class CHintEngine
+ * \brief Best move over the next moves, with a bound on the time spent
+ *
+ * The search deepens one move at a time, from 1 (the greedy move) up to
+ *  the maximal depth, and keeps the answer of the deepest search finished
+ *  before the budget ran out. The budget is checked before each swap : a
+ *  query overruns it by one swap and its cascade at most. On a grid too
+ *  large for even the greedy search, the best of the moves examined in
+ *  time is given. Positions already valued are
+ *  found again in a transposition table keyed on HashGrid and the depth :
+ *  two orders of the same swaps often give the same grid, and each search
+ *  reuses the values of the previous ones.
+ *
+ * The value of a move is the score of its cascades, the grid refilling
+ *  nothing : it is exact, not an expectation. At equal values the first
+ *  move FindMoves gives is kept, as CLookaheadPolicy does.
+ *
+ */
+	class CHintEngine
+	{
+		typedef std::chrono::steady_clock CClock;
+
+/**
+ * \struct CEntry
+ * \brief A position of the transposition table
+ *
+ */
+		struct CEntry
+		{
+			std::uint64_t Key;
+			std::uint32_t Gain;
+			std::uint32_t Depth; ///< 0 : empty
+		}; // CEntry
+
+		std::vector <CEntry>                m_Table; ///< Power of two size
+		std::vector <std::vector <CMove> >  m_Moves; ///< One per depth
+		std::vector <CGrid>                 m_Grids; ///< One per depth
+		std::vector <CPosition>             m_Swapped;
+		unsigned                            m_MaxDepth;
+		std::chrono::microseconds           m_Budget;
+		CClock::time_point                  m_Deadline;
+		bool                                m_IsTimed;
+		bool                                m_IsStopped;
+		unsigned                            m_NbNodes;
+
+		unsigned Search (const CGrid & Grid, unsigned Depth, CMove * Best);
+
+		CHintEngine (const CHintEngine &);
+		CHintEngine & operator = (const CHintEngine &);
+
+	  public :
+/**
+ * \fn CHintEngine (unsigned MaxDepth = KHintDepth,
+ *  unsigned Budget = KHintBudget, unsigned TableBits = KHintTableBits)
+ * \param MaxDepth Moves looked ahead at most, 1 at least
+ * \param Budget Microseconds per query, 0 for no limit (the answer then
+ *  only depends on the grid)
+ * \param TableBits Log2 of the number of positions of the table
+ *
+ */
+		explicit CHintEngine (unsigned MaxDepth = KHintDepth,
+							  unsigned Budget = KHintBudget,
+							  unsigned TableBits = KHintTableBits);
+
+/**
+ * \fn bool FindHint (const CGrid & Grid, CHint & Hint)
+ * \brief Best move of Grid
+ * \param Grid A resolved grid : nothing is aligned in it
+ * \return false if no move aligns anything
+ *
+ */
+		bool FindHint (const CGrid & Grid, CHint & Hint);
+
+	}; // CHintEngine
+
+} // namespace nsNumberCrush
+
+#endif /* __HINT_H__ */
@@ -0,0 +1,169 @@
+/**
+*
+* @file Input.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Clavier en mode brut : une touche, un événement
+*
+*/
+
+#include <cerrno>
+#include <csignal>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include "Input.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		// Attente de la suite d'une séquence d'échappement, en ms
+		const int KEscapeDelay = 30;
+
+		// Signaux qui terminent le jeu : le terminal est rendu avant
+		const int      KSignals []  = { SIGINT, SIGTERM, SIGHUP, SIGQUIT };
+		const unsigned KNbSignals   = sizeof (KSignals) / sizeof (int);
+		const char     KShowCursor [] = "\033[?25h";
+
+		// Un seul clavier en mode brut à la fois
+		termios          Saved;
+		struct sigaction Previous [KNbSignals];
+
+		// Que des appels sûrs dans un gestionnaire de signal ; l'action
+		//  par défaut, remise à l'entrée, termine ensuite le processus
+		void RestoreTerminal (int Signal)
+		{
+			tcsetattr (STDIN_FILENO, TCSANOW, &Saved);
+			const ssize_t NbWritten = write (STDOUT_FILENO, KShowCursor,
+											 sizeof (KShowCursor) - 1);
+			(void) NbWritten;
+			raise (Signal);
+		} // RestoreTerminal
+
+		CEvent MakeEvent (CEventType Type, char Key = 0)
+		{
+			CEvent Event;
+			Event.Type = Type;
+			Event.Key  = Key;
+			return Event;
+		} // MakeEvent
+
+	} // namespace
+
+	CKeyboard::CKeyboard ()
+		: m_Raw (isatty (STDIN_FILENO) && 0 == tcgetattr (STDIN_FILENO,
+														   &m_Saved))
+	{
+		if (!m_Raw) return;
+
+		// Ctrl-C reste actif : avant de terminer le jeu, il rend l'écho
+		//  et le curseur
+		Saved = m_Saved;
+		struct sigaction Action;
+		Action.sa_handler = RestoreTerminal;
+		sigemptyset (&Action.sa_mask);
+		Action.sa_flags = SA_RESETHAND;
+		for (unsigned i = 0; i < KNbSignals; ++i)
+		{
+			sigaction (KSignals [i], 0, &Previous [i]);
+			if (Previous [i].sa_handler != SIG_IGN)
+				sigaction (KSignals [i], &Action, 0);
+		}
+
+		// Ni écho ni attente de Entrée
+		termios Raw = m_Saved;
+		Raw.c_lflag &= ~(ICANON | ECHO);
+		Raw.c_cc [VMIN]  = 1;
+		Raw.c_cc [VTIME] = 0;
+		m_Raw = 0 == tcsetattr (STDIN_FILENO, TCSANOW, &Raw);
+		if (!m_Raw)
+			for (unsigned i = 0; i < KNbSignals; ++i)
+				sigaction (KSignals [i], &Previous [i], 0);
+	} // CKeyboard
+
+	CKeyboard::~CKeyboard ()
+	{
+		if (!m_Raw) return;
+		tcsetattr (STDIN_FILENO, TCSANOW, &m_Saved);
+		for (unsigned i = 0; i < KNbSignals; ++i)
+			sigaction (KSignals [i], &Previous [i], 0);
+	} // ~CKeyboard
+
+	int CKeyboard::Read (int Timeout)
+	{
+		pollfd Input = { STDIN_FILENO, POLLIN, 0 };
+		const int NbReady = poll (&Input, 1, Timeout);
+		if (0 == NbReady) return 0;
+		if (NbReady < 0) return EINTR == errno ? 0 : -1;
+
+		char Bytes [64];
+		const ssize_t NbRead = read (STDIN_FILENO, Bytes, sizeof (Bytes));
+		if (NbRead < 0) return EINTR == errno ? 0 : -1;
+		if (0 == NbRead) return -1;
+		m_Pending.append (Bytes, NbRead);
+		return NbRead;
+	} // Read
+
+	CEvent CKeyboard::Wait (int Timeout)
+	{
+		for (;;)
+		{
+			if (m_Pending.empty ())
+			{
+				if (!m_Raw) return MakeEvent (KEnd);
+				const int NbRead = Read (Timeout);
+				if (NbRead < 0)  return MakeEvent (KEnd);
+				if (0 == NbRead) return MakeEvent (KTick);
+				continue;
+			}
+
+			const char Key = m_Pending [0];
+			if (Key != '\033')
+			{
+				m_Pending.erase (0, 1);
+				return MakeEvent (KKey, Key);
+			}
+
+			// Échap seul, ou début d'une séquence pas encore lue en entier
+			if (1 == m_Pending.size ())
+			{
+				if (Read (KEscapeDelay) <= 0) m_Pending.clear ();
+				continue;
+			}
+			if (m_Pending [1] != '[' && m_Pending [1] != 'O')
+			{
+				m_Pending.erase (0, 1);
+				continue;
+			}
+
+			// ESC [ ... lettre, ou ESC O lettre : flèches A B C D
+			string::size_type End = 2;
+			while (End < m_Pending.size () &&
+				   (m_Pending [End] < '@' || m_Pending [End] > '~'))
+				++End;
+			if (End == m_Pending.size ())
+			{
+				if (Read (KEscapeDelay) <= 0) m_Pending.clear ();
+				continue;
+			}
+
+			const char Final = m_Pending [End];
+			m_Pending.erase (0, End + 1);
+			switch (Final)
+			{
+			  case 'A' : return MakeEvent (KUp);
+			  case 'B' : return MakeEvent (KDown);
+			  case 'C' : return MakeEvent (KRight);
+			  case 'D' : return MakeEvent (KLeft);
+			}
+		}
+	} // Wait
+
+} // namespace nsNumberCrush
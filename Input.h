@@ -0,0 +1,94 @@
+/**
+*
+* @file Input.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Clavier en mode brut : une touche, un événement
+*
+*/
+
+#ifndef __INPUT_H__
+#define __INPUT_H__
+
+#include <string>
+
+#include <termios.h>
+
+namespace nsNumberCrush
+{
+/**
+ * \enum CEventType
+ * \brief What happened while waiting for the keyboard
+ *
+ */
+	enum CEventType
+	{
+		KTick,   ///< Nothing before the timeout
+		KKey,    ///< A plain key, in CEvent::Key
+		KUp,
+		KDown,
+		KLeft,
+		KRight,
+		KEnd     ///< No more input
+	}; // CEventType
+
+/**
+ * \struct CEvent
+ * \brief One keystroke, or the end of a wait
+ *
+ */
+	struct CEvent
+	{
+		CEventType Type;
+		char       Key;   ///< Key pressed when Type is KKey
+	}; // CEvent
+
+/**
+ * \class CKeyboard
+ * \brief Puts the terminal in raw mode (no echo, no line buffering)
+ *  for its lifetime and turns the keys read into events
+ *
+ * Ctrl-C, and the other signals that end the process (SIGTERM, SIGHUP,
+ *  SIGQUIT), still do, but give the terminal its settings and its cursor
+ *  back first. Only one keyboard may be raw at a time.
+ *
+ */
+	class CKeyboard
+	{
+		termios     m_Saved;    ///< Terminal settings to give back
+		bool        m_Raw;
+		std::string m_Pending;  ///< Bytes read but not decoded yet
+
+		int Read (int Timeout);
+
+		CKeyboard (const CKeyboard &);
+		CKeyboard & operator = (const CKeyboard &);
+
+	  public :
+		CKeyboard ();
+		~CKeyboard ();
+
+/**
+ * \fn bool IsRaw () const
+ * \brief false if stdin is not a terminal : no event can be read then
+ *
+ */
+		bool IsRaw () const { return m_Raw; }
+
+/**
+ * \fn CEvent Wait (int Timeout)
+ * \brief Next keystroke, arrow keys decoded
+ * \param Timeout Milliseconds to wait for it, -1 for no limit
+ * \return A KTick event if no key came in time
+ *
+ */
+		CEvent Wait (int Timeout);
+
+	}; // CKeyboard
+
+} // namespace nsNumberCrush
+
+#endif /* __INPUT_H__ */
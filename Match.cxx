@@ -0,0 +1,389 @@
+/**
+*
+* @file Match.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Détection des alignements d'au moins trois nombres
+*
+*/
+
+#include <algorithm>
+
+#include "Counters.h"
+#include "Match.h"
+#include "RowScan.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+/**
+ * \fn unsigned NbFollowingBits (const CWord * Line, unsigned NbWords,
+ *  unsigned Bit)
+ * \brief Number of consecutive set bits of Line from Bit onwards
+ *
+ */
+		unsigned NbFollowingBits (const CWord * Line, unsigned NbWords,
+								  unsigned Bit)
+		{
+			unsigned Nb = 0;
+			for (unsigned Word = Bit / KBitsPerWord,
+						  Shift = Bit % KBitsPerWord;
+				 Word < NbWords; ++Word, Shift = 0)
+			{
+				const CWord Holes = ~(Line [Word] >> Shift);
+				if (0 == Holes)
+				{
+					Nb += KBitsPerWord;
+					continue;
+				}
+				const unsigned Ones = __builtin_ctzll (Holes);
+				Nb += Ones;
+				if (Ones < KBitsPerWord - Shift) break;
+			}
+			return Nb;
+		} // NbFollowingBits
+
+/**
+ * \fn void AppendRuns (const CCell * Cells, unsigned Line, unsigned Offset,
+ *  bool Vertical, const vector <CWord> & Starts, vector <CRun> & Runs)
+ * \brief Append one run per sequence of set bits of Starts : each bit
+ *  starts three identical numbers, so a sequence of Nb bits is a run of
+ *  Nb + 2 cells
+ * \param Cells The row, or the column
+ * \param Line Its number
+ * \param Offset First cell of Cells Starts was computed from
+ *
+ */
+		void AppendRuns (const CCell * Cells, unsigned Line, unsigned Offset,
+						 bool Vertical, const vector <CWord> & Starts,
+						 vector <CRun> & Runs)
+		{
+			const unsigned NbWords = Starts.size ();
+			for (unsigned Word = 0; Word < NbWords; ++Word)
+			{
+				// Seul le début de chaque suite de bits est gardé
+				CWord Heads = Starts [Word] & ~(Starts [Word] << 1);
+				if (Word > 0)
+					Heads &= ~(Starts [Word - 1] >> (KBitsPerWord - 1));
+				for (; Heads; Heads &= Heads - 1)
+				{
+					const unsigned Bit = Word * KBitsPerWord +
+										 __builtin_ctzll (Heads);
+					const unsigned First = Offset + Bit;
+					CRun Run;
+					Run.Pos      = Vertical ? make_pair (First, Line)
+											: make_pair (Line, First);
+					Run.Length   = NbFollowingBits (&Starts [0], NbWords,
+													Bit) + 2;
+					Run.Vertical = Vertical;
+					Run.Candy    = Cells [First];
+					Runs.push_back (Run);
+				}
+			}
+		} // AppendRuns
+
+/**
+ * \fn bool FirstRun (const CCell * Cells, unsigned NbCells,
+ *  unsigned & First, unsigned & HowMany)
+ * \brief First alignment of a row, or of a column, if any
+ *
+ */
+		bool FirstRun (const CCell * Cells, unsigned NbCells,
+					   unsigned & First, unsigned & HowMany)
+		{
+			static thread_local vector <CWord> Starts;
+			const unsigned NbWords = (NbCells + KBitsPerWord - 1) /
+									 KBitsPerWord;
+			Starts.resize (NbWords);
+			RowStarts (Cells, NbCells, &Starts [0]);
+
+			HowMany = 0;
+			for (unsigned Word = 0; Word < NbWords; ++Word)
+				if (Starts [Word])
+				{
+					First = Word * KBitsPerWord +
+							__builtin_ctzll (Starts [Word]);
+					HowMany = NbFollowingBits (&Starts [0], NbWords,
+											   First) + 2;
+					return true;
+				}
+			return false;
+		} // FirstRun
+
+		// Les cases elles-mêmes, 32 à la fois, tous nombres confondus
+		void FindRowRuns (const CGrid & Grid, unsigned Row,
+						  vector <CWord> & Starts, vector <CRun> & Runs)
+		{
+			Starts.resize (Grid.GetNbWords ());
+			RowStarts (Grid.GetLine (Row), Grid.GetNbCols (), &Starts [0]);
+			AppendRuns (Grid.GetLine (Row), Row, 0, false, Starts, Runs);
+		} // FindRowRuns
+
+		// Les colonnes recopiées en continu : comme les lignes
+		void FindColumnRunsCells (const CGrid & Grid, const CWord * Cols,
+								  vector <CWord> & Starts,
+								  vector <CRun> & Runs)
+		{
+			const unsigned NbRows = Grid.GetNbRows ();
+			Starts.resize ((NbRows + KBitsPerWord - 1) / KBitsPerWord);
+			for (unsigned Word = 0; Word < Grid.GetNbWords (); ++Word)
+			{
+				CWord Mask = Cols ? Cols [Word] : ~CWord (0);
+				for (; Mask; Mask &= Mask - 1)
+				{
+					const unsigned Col = Word * KBitsPerWord +
+										 __builtin_ctzll (Mask);
+					if (Col >= Grid.GetNbCols ()) break;
+					RowStarts (Grid.GetColumn (Col), NbRows, &Starts [0]);
+					AppendRuns (Grid.GetColumn (Col), Col, 0, true, Starts,
+								Runs);
+				}
+			}
+		} // FindColumnRunsCells
+
+/**
+ * \fn void FindColumnRuns (const CGrid & Grid, const CWord * Cols,
+ *  vector <CWord> & Starts, vector <CRun> & Runs)
+ * \brief Append the column alignments, only in the columns whose bit is
+ *  set in Cols (every column if Cols is null)
+ *
+ * Without the column-major copy of the grid, works on the bitboard
+ *  planes, 64 columns at a time.
+ *
+ */
+		void FindColumnRuns (const CGrid & Grid, const CWord * Cols,
+							 vector <CWord> & Starts, vector <CRun> & Runs)
+		{
+			const unsigned NbRows  = Grid.GetNbRows ();
+			const unsigned NbWords = Grid.GetNbWords ();
+			if (NbRows < 3) return;
+			if (Grid.HasColumns ())
+				return FindColumnRunsCells (Grid, Cols, Starts, Runs);
+
+			// Ligne de départ de la suite en cours, pour chaque bit du mot
+			unsigned FirstRow [KBitsPerWord];
+
+			for (unsigned Candy = 1; Candy <= KMaxCandies; ++Candy)
+				for (unsigned Word = 0; Word < NbWords; ++Word)
+				{
+					const CWord Mask = Cols ? Cols [Word] : ~CWord (0);
+					if (0 == Mask) continue;
+
+					const CWord * Plane = Grid.GetPlane (Candy, 0) + Word;
+					CWord Prev = 0;
+					for (unsigned Row = 0; Row + 2 <= NbRows; ++Row,
+						 Plane += NbWords)
+					{
+						// La dernière itération vide les suites en cours
+						const CWord Cur = Row + 2 == NbRows ? 0 : Mask &
+							Plane [0] & Plane [NbWords] & Plane [2 * NbWords];
+
+						for (CWord Heads = Cur & ~Prev; Heads;
+							 Heads &= Heads - 1)
+							FirstRow [__builtin_ctzll (Heads)] = Row;
+
+						for (CWord Tails = Prev & ~Cur; Tails;
+							 Tails &= Tails - 1)
+						{
+							const unsigned Bit = __builtin_ctzll (Tails);
+							CRun Run;
+							Run.Pos      = make_pair (FirstRow [Bit],
+												Word * KBitsPerWord + Bit);
+							Run.Length   = Row - FirstRow [Bit] + 2;
+							Run.Vertical = true;
+							Run.Candy    = Candy;
+							Runs.push_back (Run);
+						}
+						Prev = Cur;
+					}
+				}
+		} // FindColumnRuns
+
+/**
+ * \struct CSpan
+ * \brief Changed cells of one row (or column), from First to Last ; empty
+ *  when First > Last
+ *
+ */
+		struct CSpan
+		{
+			unsigned First;
+			unsigned Last;
+		}; // CSpan
+
+		const CSpan KNoSpan = { 1, 0 };
+
+		// Les lignes touchées sont ajoutées à Lines la première fois
+		void Widen (vector <CSpan> & Spans, vector <unsigned> & Lines,
+					unsigned Line, unsigned Cell)
+		{
+			CSpan & Span = Spans [Line];
+			if (Span.First > Span.Last)
+			{
+				Span.First = Span.Last = Cell;
+				Lines.push_back (Line);
+				return;
+			}
+			Span.First = min (Span.First, Cell);
+			Span.Last  = max (Span.Last,  Cell);
+		} // Widen
+
+/**
+ * \fn unsigned FindSpanRuns (const CCell * Cells, unsigned NbCells,
+ *  unsigned Line, bool Vertical, CSpan & Span, vector <CWord> & Starts,
+ *  vector <CRun> & Runs)
+ * \brief Append the alignments of a row (column) around its changed
+ *  cells, then empty Span for the next call
+ * \return Number of cells read
+ *
+ */
+		unsigned FindSpanRuns (const CCell * Cells, unsigned NbCells,
+							   unsigned Line, bool Vertical, CSpan & Span,
+							   vector <CWord> & Starts, vector <CRun> & Runs)
+		{
+			const unsigned First = Span.First < 2 ? 0 : Span.First - 2;
+			const unsigned Last  = min (Span.Last + 2, NbCells - 1);
+			Span = KNoSpan;
+			if (Last < First + 2) return 0;
+
+			const unsigned NbRead = Last - First + 1;
+			Starts.resize ((NbRead + KBitsPerWord - 1) / KBitsPerWord);
+			RowStarts (Cells + First, NbRead, &Starts [0]);
+			AppendRuns (Cells, Line, First, Vertical, Starts, Runs);
+			return NbRead;
+		} // FindSpanRuns
+
+	} // namespace
+
+	void FindMatches (const CGrid & Grid, vector <CRun> & Runs)
+	{
+		NC_STAGE (KStageScan);
+		NC_COUNT (KStageScan, Grid.GetNbRows () * Grid.GetNbCols ());
+		static thread_local vector <CWord> Starts;
+		Runs.clear ();
+		for (unsigned Row = 0; Row < Grid.GetNbRows (); ++Row)
+			FindRowRuns (Grid, Row, Starts, Runs);
+		FindColumnRuns (Grid, 0, Starts, Runs);
+	} // FindMatches
+
+	void FindMatches (const CGrid & Grid, const CLineMask & Rows,
+					  const CLineMask & Cols, vector <CRun> & Runs)
+	{
+		NC_STAGE (KStageScan);
+		static thread_local vector <CWord> Starts;
+		Runs.clear ();
+		for (unsigned Word = 0; Word < Rows.size (); ++Word)
+			for (CWord Bits = Rows [Word]; Bits; Bits &= Bits - 1)
+				FindRowRuns (Grid, Word * KBitsPerWord +
+								   __builtin_ctzll (Bits), Starts, Runs);
+		FindColumnRuns (Grid, Cols.data (), Starts, Runs);
+	} // FindMatches
+
+	unsigned FindMatches (const CGrid & Grid, const vector <CPosition> & Cells,
+						  vector <CRun> & Runs)
+	{
+		NC_STAGE (KStageScan);
+		static thread_local vector <CWord>    Starts;
+		static thread_local vector <CSpan>    RowSpans, ColSpans;
+		static thread_local vector <unsigned> Rows, Cols;
+		static thread_local CLineMask         ColMask;
+
+		const unsigned NbRows = Grid.GetNbRows ();
+		const unsigned NbCols = Grid.GetNbCols ();
+		Runs.clear ();
+		Rows.clear ();
+		Cols.clear ();
+		// Toujours vides entre deux appels : seule la taille peut manquer
+		if (RowSpans.size () < NbRows) RowSpans.resize (NbRows, KNoSpan);
+		if (ColSpans.size () < NbCols) ColSpans.resize (NbCols, KNoSpan);
+		for (unsigned i = 0; i < Cells.size (); ++i)
+		{
+			Widen (RowSpans, Rows, Cells [i].first, Cells [i].second);
+			Widen (ColSpans, Cols, Cells [i].second, Cells [i].first);
+		}
+
+		unsigned NbRead = 0;
+		for (unsigned i = 0; i < Rows.size (); ++i)
+			NbRead += FindSpanRuns (Grid.GetLine (Rows [i]), NbCols, Rows [i],
+									false, RowSpans [Rows [i]], Starts, Runs);
+		if (Grid.HasColumns ())
+			for (unsigned i = 0; i < Cols.size (); ++i)
+				NbRead += FindSpanRuns (Grid.GetColumn (Cols [i]), NbRows,
+										Cols [i], true, ColSpans [Cols [i]],
+										Starts, Runs);
+		else
+		{
+			// Sans la copie des colonnes : les plans, colonnes entières
+			ResetLineMask (ColMask, NbCols);
+			for (unsigned i = 0; i < Cols.size (); ++i)
+			{
+				MarkLine (ColMask, Cols [i]);
+				ColSpans [Cols [i]] = KNoSpan;
+			}
+			NbRead += Cols.size () * NbRows;
+			FindColumnRuns (Grid, ColMask.data (), Starts, Runs);
+		}
+		NC_COUNT (KStageScan, NbRead);
+		(void) NbRead;
+		return Rows.size () + Cols.size ();
+	} // FindMatches
+
+	bool AtLeastThreeInAColumn (const CGrid & Grid, CPosition & Pos,
+								unsigned & HowMany)
+	{
+		unsigned First;
+		if (Grid.HasColumns ())
+		{
+			// La colonne est contiguë : 32 cases à la fois, comme une ligne
+			if (!FirstRun (Grid.GetColumn (Pos.second), Grid.GetNbRows (),
+						   First, HowMany))
+				return false;
+			Pos = make_pair (First, Pos.second);
+			return true;
+		}
+
+		HowMany = 0;
+		unsigned i = 1;
+		for (; (i < Grid.GetNbRows ()) && (HowMany < 2); ++i)
+		{
+			if (Grid (i - 1, Pos.second) == 0 ||
+				Grid (i - 1, Pos.second) != Grid (i, Pos.second))
+			{
+				HowMany = 0;
+				continue;
+			}
+			++HowMany;
+		}
+		if (2 == HowMany)
+		{
+			HowMany = 1;
+			i -= 3;
+			Pos = make_pair (i, Pos.second);
+			for (; (i < Grid.GetNbRows () - 1) &&
+				(Grid (i + 1, Pos.second) == Grid (i, Pos.second)); ++i)
+				++HowMany;
+			return true;
+		}
+		else
+			return false;
+	} // AtLeastThreeInAColumn
+
+	bool AtLeastThreeInARow (const CGrid & Grid, CPosition & Pos,
+							 unsigned & HowMany)
+	{
+		// Tous les débuts de suites de la ligne, 32 cases à la fois
+		unsigned First;
+		if (!FirstRun (Grid.GetLine (Pos.first), Grid.GetNbCols (), First,
+					   HowMany))
+			return false;
+		Pos = make_pair (Pos.first, First);
+		return true;
+	} // AtLeastThreeInARow
+
+} // namespace nsNumberCrush
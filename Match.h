@@ -0,0 +1,130 @@
+/**
+*
+* @file Match.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Détection des alignements d'au moins trois nombres
+*
+*/
+
+#ifndef __MATCH_H__
+#define __MATCH_H__
+
+#include <vector>
+
+#include "Grid.h"
+
+namespace nsNumberCrush
+{
+/**
+ * \struct CRun
+ * \brief Maximal alignment of at least three identical numbers
+ *
+ */
+	struct CRun
+	{
+		CPosition Pos;      ///< Top or left cell of the alignment
+		unsigned  Length;   ///< Number of aligned cells (at least 3)
+		bool      Vertical; ///< true for a column, false for a row
+		CCell     Candy;    ///< Number shared by the aligned cells
+	}; // CRun
+
+/**
+ * \fn void FindMatches (const CGrid & Grid, std::vector <CRun> & Runs)
+ * \brief Find every row and column alignment of the grid in one pass
+ * \param Grid The matrix
+ * \param Runs Cleared, then filled with the rows first, then the columns
+ *
+ * Rows compare their cells with themselves shifted by one and by two,
+ *  32 cells at a time (see RowStarts) ; so do the columns, in the
+ *  column-major copy of the grid. A grid without it (see
+ *  CGrid::KeepColumns) has its columns read on the bitboard planes, 64
+ *  columns at a time.
+ *
+ */
+	void FindMatches (const CGrid & Grid, std::vector <CRun> & Runs);
+
+/**
+ * \typedef CLineMask
+ * \brief Set of lines (or columns) of the grid, one bit per line
+ *
+ */
+	typedef std::vector <CWord> CLineMask;
+
+/**
+ * \fn void ResetLineMask (CLineMask & Mask, unsigned NbLines)
+ * \brief Resize Mask for NbLines lines, none of them selected
+ *
+ */
+	inline void ResetLineMask (CLineMask & Mask, unsigned NbLines)
+	{
+		Mask.assign ((NbLines + KBitsPerWord - 1) / KBitsPerWord, 0);
+	} // ResetLineMask
+
+	inline void MarkLine (CLineMask & Mask, unsigned Line)
+	{
+		Mask [Line / KBitsPerWord] |= CWord (1) << (Line % KBitsPerWord);
+	} // MarkLine
+
+/**
+ * \fn void FindMatches (const CGrid & Grid, const CLineMask & Rows,
+ *  const CLineMask & Cols, std::vector <CRun> & Runs)
+ * \brief Same as FindMatches, limited to the selected rows and columns
+ * \param Rows Rows to examine, sized for Grid.GetNbRows () lines
+ * \param Cols Columns to examine, sized for Grid.GetNbCols () lines
+ *
+ */
+	void FindMatches (const CGrid & Grid, const CLineMask & Rows,
+					  const CLineMask & Cols, std::vector <CRun> & Runs);
+
+/**
+ * \fn unsigned FindMatches (const CGrid & Grid,
+ *  const std::vector <CPosition> & Cells, std::vector <CRun> & Runs)
+ * \brief Alignments going through at least one of Cells, on a grid that
+ *  had none before they changed
+ * \param Cells The changed cells, in any order, repeated or not
+ * \param Runs Cleared, then filled with the rows first, then the columns
+ * \return Number of rows plus columns examined
+ *
+ * Three unchanged cells in a row could not be identical, so an alignment
+ *  ends at most two cells past the last changed one : each row (column)
+ *  is only read from two cells before its first changed cell to two cells
+ *  after its last one.
+ *
+ */
+	unsigned FindMatches (const CGrid & Grid,
+						  const std::vector <CPosition> & Cells,
+						  std::vector <CRun> & Runs);
+
+/**
+ * \fn bool AtLeastThreeInAColumn (const CGrid & Grid, CPosition & Pos,
+ *  unsigned & HowMany)
+ * \brief Return true if at least three same numbers are aligned in a column
+ * \param Grid The matrix
+ * \param Pos It's a pair of unsigned numbers, represent the position of
+ *  number you want to move
+ * \param HowMany Represent the number of consecutive elements
+ *
+ */
+	bool AtLeastThreeInAColumn (const CGrid & Grid, CPosition & Pos,
+								unsigned & HowMany);
+
+/**
+ * \fn bool AtLeastThreeInARow (const CGrid & Grid, CPosition & Pos,
+ *  unsigned & HowMany)
+ * \brief Return true if at least three same numbers are  aligned in a row
+ * \param Grid The matrix
+ * \param Pos It's a pair of unsigned numbers, represent the position of
+ *  number you want to move
+ * \param HowMany Represent the number of consecutive elements
+ *
+ */
+	bool AtLeastThreeInARow (const CGrid & Grid, CPosition & Pos,
+							 unsigned & HowMany);
+
+} // namespace nsNumberCrush
+
+#endif /* __MATCH_H__ */
@@ -0,0 +1,102 @@
+/**
+*
+* @file Mode.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Modes de jeu : limite de la partie et calcul du score
+*
+*/
+
+#include <iomanip>
+#include <sstream>
+
+#include "Mode.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	const char * CStandardMode::GetName (bool Fr) const
+	{
+		return Fr ? "standard" : "Standard";
+	} // GetName
+
+	const char * CStandardMode::GetHelp (bool Fr) const
+	{
+		return Fr ? "aide.txt" : "help.txt";
+	} // GetHelp
+
+	void CStandardMode::Start (const CDifficulty &)
+	{
+		m_Start = CCountdown::CClock::now ();
+	} // Start
+
+	bool CStandardMode::IsOver (const CGame & Game) const
+	{
+		return 0 == Game.NbMove;
+	} // IsOver
+
+	string CStandardMode::GetStatus (const CGame & Game, bool Fr) const
+	{
+		ostringstream Status;
+		Fr ? Status << "Il reste : " << Game.NbMove << " deplacements"
+		   : Status << Game.NbMove << " moves remaining";
+		return Status.str ();
+	} // GetStatus
+
+	unsigned CStandardMode::GetElapsed () const
+	{
+		return chrono::duration_cast <chrono::seconds> (
+			CCountdown::CClock::now () - m_Start).count ();
+	} // GetElapsed
+
+	unsigned CStandardMode::GetScore (const CGame & Game,
+									  unsigned Ecart) const
+	{
+		return StandardScore (Game, Ecart);
+	} // GetScore
+
+	const char * CChronoMode::GetName (bool Fr) const
+	{
+		return Fr ? "chrono" : "time";
+	} // GetName
+
+	const char * CChronoMode::GetHelp (bool Fr) const
+	{
+		return Fr ? "aide2.txt" : "help2.txt";
+	} // GetHelp
+
+	void CChronoMode::Start (const CDifficulty & Params)
+	{
+		// Compte à rebours sur l'horloge monotone : la partie s'arrête à
+		//  la limite, même en pleine saisie
+		m_Timer = CCountdown (Params.TimeLimit);
+	} // Start
+
+	bool CChronoMode::IsOver (const CGame &) const
+	{
+		return m_Timer.IsOver ();
+	} // IsOver
+
+	string CChronoMode::GetStatus (const CGame &, bool) const
+	{
+		ostringstream Status;
+		Status << "Chrono : " << fixed << setprecision (1)
+			   << m_Timer.GetLeft () << " s";
+		return Status.str ();
+	} // GetStatus
+
+	unsigned CChronoMode::GetElapsed () const
+	{
+		return unsigned (m_Timer.GetElapsed ());
+	} // GetElapsed
+
+	unsigned CChronoMode::GetScore (const CGame & Game, unsigned Ecart) const
+	{
+		return ChronoScore (Game, Ecart);
+	} // GetScore
+
+} // namespace nsNumberCrush
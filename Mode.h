@@ -0,0 +1,153 @@
+/**
+*
+* @file Mode.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Modes de jeu : limite de la partie et calcul du score
+*
+*/
+
+#ifndef __MODE_H__
+#define __MODE_H__
+
+#include <string>
+
+#include "Engine.h"
+#include "Timer.h"
+
+namespace nsNumberCrush
+{
+	const unsigned KNbModes = 2; ///< Standard, chrono
+
+/**
+ * \class CGameMode
+ * \brief What differs between two game modes : the limit of a game,
+ *  what is shown about it and the final score
+ *
+ */
+	class CGameMode
+	{
+	  public :
+		virtual ~CGameMode () {}
+
+/**
+ * \fn const char * GetName (bool Fr) const
+ * \brief Name of the mode in the menu ("chrono", "time" ...)
+ *
+ */
+		virtual const char * GetName (bool Fr) const = 0;
+
+/**
+ * \fn unsigned GetId () const
+ * \brief Number of the mode in the score files, below KNbModes
+ *
+ */
+		virtual unsigned GetId () const = 0;
+
+/**
+ * \fn const char * GetHelp (bool Fr) const
+ * \brief Name of the help text, for GetAsset
+ *
+ */
+		virtual const char * GetHelp (bool Fr) const = 0;
+
+/**
+ * \fn void Start (const CDifficulty & Params)
+ * \brief Called when a game starts, before the first move
+ *
+ */
+		virtual void Start (const CDifficulty & Params) = 0;
+
+/**
+ * \fn bool IsOver (const CGame & Game) const
+ * \brief true once the limit of the mode is reached
+ *
+ */
+		virtual bool IsOver (const CGame & Game) const = 0;
+
+/**
+ * \fn std::string GetStatus (const CGame & Game, bool Fr) const
+ * \brief One line telling how far the limit is, without new line
+ *
+ */
+		virtual std::string GetStatus (const CGame & Game,
+									   bool Fr) const = 0;
+
+/**
+ * \fn const CCountdown * GetTimer () const
+ * \brief Clock the player plays against, 0 if there is none
+ *
+ */
+		virtual const CCountdown * GetTimer () const { return 0; }
+
+/**
+ * \fn unsigned GetElapsed () const
+ * \brief Whole seconds the game has lasted, as they count in the score
+ *
+ */
+		virtual unsigned GetElapsed () const = 0;
+
+/**
+ * \fn unsigned GetScore (const CGame & Game, unsigned Ecart) const
+ * \brief Final score of a game that just ended
+ * \param Ecart Duration of the game, from GetElapsed (or a replay)
+ *
+ */
+		virtual unsigned GetScore (const CGame & Game,
+								   unsigned Ecart) const = 0;
+
+	}; // CGameMode
+
+/**
+ * \class CStandardMode
+ * \brief A given number of moves ; the faster, the better the score
+ *
+ */
+	class CStandardMode : public CGameMode
+	{
+		CCountdown::CClock::time_point m_Start;
+
+	  public :
+		virtual const char * GetName (bool Fr) const;
+		virtual unsigned     GetId   () const { return 0; }
+		virtual const char * GetHelp (bool Fr) const;
+		virtual void         Start   (const CDifficulty & Params);
+		virtual bool         IsOver  (const CGame & Game) const;
+		virtual std::string  GetStatus (const CGame & Game, bool Fr) const;
+		virtual unsigned     GetElapsed () const;
+		virtual unsigned     GetScore  (const CGame & Game,
+										unsigned Ecart) const;
+
+	}; // CStandardMode
+
+/**
+ * \class CChronoMode
+ * \brief As many moves as the time limit allows
+ *
+ */
+	class CChronoMode : public CGameMode
+	{
+		CCountdown m_Timer;
+
+	  public :
+		CChronoMode () : m_Timer (0) {}
+
+		virtual const char * GetName (bool Fr) const;
+		virtual unsigned     GetId   () const { return 1; }
+		virtual const char * GetHelp (bool Fr) const;
+		virtual void         Start   (const CDifficulty & Params);
+		virtual bool         IsOver  (const CGame & Game) const;
+		virtual std::string  GetStatus (const CGame & Game, bool Fr) const;
+		virtual const CCountdown * GetTimer () const { return &m_Timer; }
+		virtual unsigned     GetElapsed () const;
+		virtual unsigned     GetScore  (const CGame & Game,
+										unsigned Ecart) const;
+
+	}; // CChronoMode
+
+} // namespace nsNumberCrush
+
+#endif /* __MODE_H__ */
@@ -0,0 +1,158 @@
+/**
+*
+* @file Moves.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Recherche des déplacements qui alignent au moins trois nombres
+*
+*/
+
+#include "Counters.h"
+#include "Moves.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+/**
+ * \fn unsigned NbSame (const CGrid & Grid, unsigned Row, unsigned Col,
+ *  int DRow, int DCol, CCell Candy, const CPosition & Other)
+ * \brief Number of Candy following (Row, Col) in the direction
+ *  (DRow, DCol), at most two ; stops on Other, the swapped neighbour
+ *
+ */
+		unsigned NbSame (const CGrid & Grid, unsigned Row, unsigned Col,
+						 int DRow, int DCol, CCell Candy,
+						 const CPosition & Other)
+		{
+			unsigned Nb = 0;
+			for (; Nb < 2; ++Nb)
+			{
+				Row += DRow;
+				Col += DCol;
+				// unsigned : sortir par le haut ou la gauche fait reboucler
+				if (Row >= Grid.GetNbRows () || Col >= Grid.GetNbCols () ||
+					(Row == Other.first && Col == Other.second) ||
+					Grid (Row, Col) != Candy)
+					break;
+			}
+			return Nb;
+		} // NbSame
+
+/**
+ * \fn bool Aligns (const CGrid & Grid, const CPosition & Pos,
+ *  CCell Candy, const CPosition & Other)
+ * \brief Return true if Candy, moved to Pos, is part of three in a row
+ *  or in a column
+ *
+ */
+		bool Aligns (const CGrid & Grid, const CPosition & Pos, CCell Candy,
+					 const CPosition & Other)
+		{
+			const unsigned Row = Pos.first;
+			const unsigned Col = Pos.second;
+			return NbSame (Grid, Row, Col, 0, -1, Candy, Other) +
+				   NbSame (Grid, Row, Col, 0,  1, Candy, Other) >= 2 ||
+				   NbSame (Grid, Row, Col, -1, 0, Candy, Other) +
+				   NbSame (Grid, Row, Col,  1, 0, Candy, Other) >= 2;
+		} // Aligns
+
+	} // namespace
+
+	bool Neighbour (const CGrid & Grid, const CPosition & Pos,
+					char Direction, CPosition & Other)
+	{
+		Other = Pos;
+		switch (Direction)
+		{
+		  case 'A':
+		  case 'a':
+			if (0 == Pos.second) return false;
+			--Other.second;
+			break;
+		  case 'Z':
+		  case 'z':
+			if (0 == Pos.first) return false;
+			--Other.first;
+			break;
+		  case 'E':
+		  case 'e':
+			++Other.second;
+			break;
+		  case 'S':
+		  case 's':
+			++Other.first;
+			break;
+		  default:
+			return false;
+		}
+		return Other.first < Grid.GetNbRows () &&
+			   Other.second < Grid.GetNbCols ();
+	} // Neighbour
+
+	bool CreatesMatch (const CGrid & Grid, const CPosition & Pos,
+					   char Direction)
+	{
+		CPosition Other;
+		if (Pos.first >= Grid.GetNbRows () ||
+			Pos.second >= Grid.GetNbCols () ||
+			!Neighbour (Grid, Pos, Direction, Other))
+			return false;
+
+		const CCell Moved = Grid (Pos.first, Pos.second);
+		const CCell Dest  = Grid (Other.first, Other.second);
+		if (0 == Moved || 0 == Dest || Moved == Dest) return false;
+
+		return Aligns (Grid, Other, Moved, Pos) ||
+			   Aligns (Grid, Pos, Dest, Other);
+	} // CreatesMatch
+
+	void FindMoves (const CGrid & Grid, vector <CMove> & Moves)
+	{
+		NC_STAGE (KStageMoves);
+		NC_COUNT (KStageMoves, Grid.GetNbRows () * Grid.GetNbCols ());
+		Moves.clear ();
+		CMove Move;
+		for (unsigned Row = 0; Row < Grid.GetNbRows (); ++Row)
+			for (unsigned Col = 0; Col < Grid.GetNbCols (); ++Col)
+			{
+				Move.Pos = make_pair (Row, Col);
+				Move.Direction = 'E';
+				if (CreatesMatch (Grid, Move.Pos, 'E'))
+					Moves.push_back (Move);
+				Move.Direction = 'S';
+				if (CreatesMatch (Grid, Move.Pos, 'S'))
+					Moves.push_back (Move);
+			}
+	} // FindMoves
+
+	bool AnyMove (const CGrid & Grid)
+	{
+		NC_STAGE (KStageMoves);
+		NC_COUNT (KStageMoves, Grid.GetNbRows () * Grid.GetNbCols ());
+		for (unsigned Row = 0; Row < Grid.GetNbRows (); ++Row)
+			for (unsigned Col = 0; Col < Grid.GetNbCols (); ++Col)
+				if (CreatesMatch (Grid, make_pair (Row, Col), 'E') ||
+					CreatesMatch (Grid, make_pair (Row, Col), 'S'))
+					return true;
+		return false;
+	} // AnyMove
+
+	bool NombreCombiRestante (unsigned & CptTot, const CGrid & Grid)
+	{
+		NC_STAGE (KStageMoves);
+		NC_COUNT (KStageMoves, Grid.GetNbRows () * Grid.GetNbCols ());
+		CptTot = 0;
+		for (unsigned Row = 0; Row < Grid.GetNbRows (); ++Row)
+			for (unsigned Col = 0; Col < Grid.GetNbCols (); ++Col)
+				CptTot += CreatesMatch (Grid, make_pair (Row, Col), 'E') +
+						  CreatesMatch (Grid, make_pair (Row, Col), 'S');
+		return CptTot != 0;
+	} // NombreCombiRestante
+
+} // namespace nsNumberCrush
@@ -0,0 +1,88 @@
+/**
+*
+* @file Moves.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Recherche des déplacements qui alignent au moins trois nombres
+*
+*/
+
+#ifndef __MOVES_H__
+#define __MOVES_H__
+
+#include <vector>
+
+#include "Grid.h"
+
+namespace nsNumberCrush
+{
+/**
+ * \struct CMove
+ * \brief Swap of a number with its right ('E') or bottom ('S') neighbour
+ *
+ */
+	struct CMove
+	{
+		CPosition Pos;       ///< Number you want to move
+		char      Direction; ///< 'E' (right) or 'S' (bottom), as in MakeAMove
+	}; // CMove
+
+/**
+ * \fn bool Neighbour (const CGrid & Grid, const CPosition & Pos,
+ *  char Direction, CPosition & Other)
+ * \brief Compute the cell Pos would be swapped with
+ * \param Direction One of the MakeAMove directions (A, Z, E or S)
+ * \param Other Set to the neighbour of Pos in Direction
+ * \return false if Direction is unknown or leaves the grid
+ *
+ */
+	bool Neighbour (const CGrid & Grid, const CPosition & Pos,
+					char Direction, CPosition & Other);
+
+/**
+ * \fn bool CreatesMatch (const CGrid & Grid, const CPosition & Pos,
+ *  char Direction)
+ * \brief Return true if swapping Pos with its neighbour in Direction
+ *  aligns at least three same numbers
+ * \param Grid The matrix
+ * \param Pos It's a pair of unsigned numbers, represent the position of
+ *  number you want to move
+ * \param Direction One of the MakeAMove directions (A, Z, E or S)
+ *
+ * Only the cells at most two steps away from the swapped cells are read.
+ *
+ */
+	bool CreatesMatch (const CGrid & Grid, const CPosition & Pos,
+					   char Direction);
+
+/**
+ * \fn void FindMoves (const CGrid & Grid, std::vector <CMove> & Moves)
+ * \brief List every swap that aligns at least three same numbers
+ * \param Grid The matrix
+ * \param Moves Cleared, then filled line after line
+ *
+ */
+	void FindMoves (const CGrid & Grid, std::vector <CMove> & Moves);
+
+/**
+ * \fn bool AnyMove (const CGrid & Grid)
+ * \brief Return true as soon as one swap aligning three numbers is found
+ *
+ */
+	bool AnyMove (const CGrid & Grid);
+
+/**
+ * \fn bool NombreCombiRestante (unsigned & CptTot, const CGrid & Grid)
+ * \brief Count the swaps that align at least three same numbers
+ * \param Grid The matrix
+ * \param CptTot Amount of possible combinations remaining
+ *
+ */
+	bool NombreCombiRestante (unsigned & CptTot, const CGrid & Grid);
+
+} // namespace nsNumberCrush
+
+#endif /* __MOVES_H__ */
@@ -0,0 +1,763 @@
+/**
+* 
+* @file NumberCrush.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L. 
+*
+* @bug
+*
+* @date 31/12/2014
+*
+* @brief Le jeu NumberCrush ; modes standard et chrono
+* 
+*/
+
+#include <iostream>
+#include <vector>
+#include <iomanip>
+#include <utility>
+#include <string> 
+#include <fstream> 
+#include <ctime>
+#include <limits>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <random>
+
+#include <unistd.h>
+
+#include "Engine.h"
+#include "Hint.h"
+#include "Render.h"
+#include "Assets.h"
+#include "Counters.h"
+#include "Mode.h"
+#include "Play.h"
+#include "Replay.h"
+#include "ScoreStore.h"
+#include "Timer.h"
+
+
+
+using namespace std;
+using namespace nsNumberCrush;
+
+/**
+ * 
+ * \namespace
+ * 
+ */
+namespace 
+{
+	 
+	
+	
+	using nsNumberCrush::NombreCombiRestante;
+	
+/**
+ * \fn void ClearScreen()
+ * \brief Clear the terminal's screen
+ * 
+ */	
+	void ClearScreen ();
+
+/**
+ * \fn void DisplayLogo()
+ * \brief Display the game logo from a file
+ * 
+ */
+	void DisplayLogo ();
+
+/**
+ * \fn void DisplayGrid (const CGrid & Grid)
+ * \brief Display the Matrix 
+ * 
+ */
+	void DisplayGrid (const CGrid & Grid);
+	
+/**
+ * \fn bool TestMove (CGrid & Grid, const CPosition & Pos, char Direction)
+ * \brief Verify if the move is possible
+ * \param Grid The matrix
+ * \param Pos It's a pair of unsigned numbers, represent the position of 
+ *  number you want to move
+ * \param Direction Char of the selected movement
+ * 
+ */	
+	bool TestMove (CGrid & Grid, const CPosition & Pos, char Direction);
+	
+/**
+ * \fn void MakeAMove (CGame & Game, const CPosition & Pos, char Direction,
+ *  CRecorder & Recorder)
+ * \brief Move the chosen number by inserting a direction 
+ * \param Game The game in progress (grid, score and move left)
+ * \param Pos It's a pair of unsigned numbers, represent the position of 
+ *  number you want to move
+ * \param Direction Char of the selected movement
+ * \param Recorder Told about the move, if the game accepts it
+ * 
+ */ 
+	void MakeAMove (CGame & Game, const CPosition & Pos, char Direction,
+					CRecorder & Recorder);
+					
+/**
+ * \fn bool ReadMove (string Language, const CGrid & Grid,
+ *  const CGameMode & Mode, CPosition & Pos, char & Direction)
+ * \brief Ask the position of the number to move, then the direction
+ * \param Mode The mode played, whose clock bounds each answer
+ * \return false if the time ran out before the player answered
+ * 
+ */
+	bool ReadMove (string Language, const CGrid & Grid,
+				   const CGameMode & Mode, CPosition & Pos,
+				   char & Direction);
+
+/**
+ * \fn void PlayWithPrompts (CGame & Game, string Language,
+ *  const CGameMode & Mode, CRecorder & Recorder)
+ * \brief Play Game by asking each move line by line, when the input is
+ *  not a terminal
+ * \param Mode The mode played, tells when the game is over
+ * \param Recorder Told about each move played
+ * 
+ */
+	void PlayWithPrompts (CGame & Game, string Language,
+						  const CGameMode & Mode, CRecorder & Recorder);
+
+/**
+ * \fn void NumberCrushV1 (string Language, string Difficulty,
+ *  CGameMode & Mode)
+ * \brief Regroup all fonctions
+ * \param Language Chosen language
+ * \param Difficulty Chosen difficulty
+ * \param Mode Chosen game mode
+ * 
+ */
+	void NumberCrushV1 (string Language, string Difficulty,
+						CGameMode & Mode);
+
+/**
+ * \fn void GameOptions (string & Language, string & Difficulty); 
+ * \brief Regroup all the games option. 
+ * \param Language Chosen language
+ * \param Difficulty Chosen difficulty
+ * 
+ */	
+	void GameOptions (string & Language, string & Difficulty); 
+
+/**
+ * \fn void Help (string Language, const CGameMode & Mode)
+ * \brief Display the help 
+ * \param Language Chosen language
+ * \param Mode Chosen game mode
+ * 
+ */
+	void Help (string Language, const CGameMode & Mode); 
+	
+/**
+ * \fn void StartMenu ()
+ * \brief Display the game menu
+ * 
+ */
+	void StartMenu ();
+	 
+/**
+ * \fn void ScoreBoard (unsigned Score, const CGameMode & Mode,
+ *  const string & Difficulty)
+ * \brief Function used to show the scoreboard
+ *  add the score to the score files, then show the best ones of the same
+ *  mode and difficulty
+ * \param Score Player's score
+ * 
+ */	
+	void ScoreBoard (unsigned Score, const CGameMode & Mode,
+					 const string & Difficulty);
+
+/**
+ * \fn bool RunReplay (const string & Path, bool RealTime)
+ * \brief Play a recorded game again and check its final score
+ * \param RealTime Show the grid after each move, at the pace the game
+ *  was played ; otherwise as fast as possible, without display
+ * \return false if the file cannot be read, a move is refused or the
+ *  score differs
+ * 
+ */
+	bool RunReplay (const string & Path, bool RealTime);
+	
+	
+   
+	// Lignes de questions sous la grille, au plus, pendant un tour
+	const unsigned KNbPromptLines = 16;
+
+	// Grille telle qu'elle est à l'écran
+	CScreen Screen;
+
+	// Répertoire des parties enregistrées (--record), aucun si vide
+	string RecordDir;
+
+	// Lectures du tableau des scores avant d'y renoncer
+	const unsigned KNbBoardTries = 5;
+
+	// Graine des grilles (--seed), tirée à chaque partie si nulle
+	uint64_t GameSeed = 0;
+
+	// Coups permis (--moves), ceux de la difficulté si nul
+	unsigned GameMoves = 0;
+
+	// Indices demandés pendant la partie, en KHintBudget µs chacun
+	CHintEngine Hints;
+
+	void ClearScreen ()
+	{
+		Screen.Invalidate ();
+		cout << "\033[H\033[2J";
+	} //ClearScreen
+	
+	void DisplayLogo ()
+	{
+		cout << GetAsset ("logo");
+	} //DisplayLogo
+	
+	void  DisplayGrid (const CGrid & Grid)
+	{
+		// Seules les cases modifiées depuis le tour précédent sont
+		//  réécrites, tout est envoyé d'un coup
+		Screen.Update (GetAsset ("logo"), Grid, KNbPromptLines);
+	} //DisplayGrid
+	
+	bool TestMove (CGrid & Grid, const CPosition & Pos, char Direction)
+	{
+		for ( unsigned i = 0; i < Grid.GetNbRows () - 1; ++i)
+		{
+			for (unsigned j = 0; j < Grid.GetNbCols () - 1; ++j)
+			{
+				if (j == Grid.GetNbCols () - 1 || j == Grid.GetNbCols () || 
+					i == Grid.GetNbRows () - 1 || i == Grid.GetNbRows ()) 
+					return false;
+			}
+		}
+		return true;
+	} //TestMove
+	
+	void MakeAMove (CGame & Game, const CPosition & Pos, char Direction,
+					CRecorder & Recorder)
+	{
+			switch (Direction)
+			{
+			  case 'A':
+			  case 'a':
+			  case 'Z':
+			  case 'z':
+			  case 'E':
+			  case 'e':
+			  case 'S':
+			  case 's':
+				if (!ApplyMove (Game, Pos, Direction))
+					cout << "Impossible" << endl;
+				else
+					Recorder.Record (Pos, Direction);
+				break;
+			  case 'q':
+			  case 'Q':
+					Game.Score = 0;
+					Recorder.Record (Pos, KGiveUp);
+					break;
+			  default:		
+				cout << "Retry" << endl; 
+				cin.ignore (numeric_limits<streamsize>::max(), '\n');
+			}
+	} //MakeAMove
+	
+	// Attend la réponse, au plus jusqu'à la fin du chrono s'il y en a un
+	bool WaitForAnswer (const CGameMode & Mode)
+	{
+		return !Mode.GetTimer () || WaitForInput (*Mode.GetTimer ());
+	} //WaitForAnswer
+	
+	// Le joueur a tapé ? au lieu du numéro de la ligne
+	bool AskedHint ()
+	{
+		if (!(cin >> ws) || cin.peek () != '?') return false;
+		cin.ignore (numeric_limits<streamsize>::max(), '\n');
+		return true;
+	} //AskedHint
+
+	void ShowHint (string Language, const CGrid & Grid)
+	{
+		CHint Hint;
+		if (!Hints.FindHint (Grid, Hint))
+		{
+			cout << (Language == "Fr" ? KNoHintFr : KNoHintEn) << endl;
+			return;
+		}
+		const bool Right = 'E' == Hint.Move.Direction;
+		Language == "Fr" ? cout << "Indice : ligne " 
+								<< Hint.Move.Pos.first + 1 << ", colonne "
+								<< Hint.Move.Pos.second + 1 << ", "
+								<< (Right ? "E - Droite" : "S - Bas") 
+								<< " (" << Hint.Gain << " points en " 
+								<< Hint.Depth << " coups)" << endl
+						 : cout << "Hint : line " 
+								<< Hint.Move.Pos.first + 1 << ", column "
+								<< Hint.Move.Pos.second + 1 << ", "
+								<< (Right ? "E - Right" : "S - Bottom") 
+								<< " (" << Hint.Gain << " points in " 
+								<< Hint.Depth << " moves)" << endl;
+	} //ShowHint
+
+	bool ReadMove (string Language, const CGrid & Grid,
+				   const CGameMode & Mode, CPosition & Pos,
+				   char & Direction)
+	{
+		Language == "Fr" ? cout << "Quelle est la position du nombre "
+									"que vous souhaitez déplacer ?" 
+								<< endl 
+						 : cout << "Where is located the number you "
+								   "want to move ?" << endl; 
+
+		Language == "Fr" ? cout << "Numéro de la ligne (? : indice) : " 
+						 : cout << "Spot of the line (? : hint) : " ; 
+		
+		if (!WaitForAnswer (Mode)) return false;
+		for (; AskedHint ();)
+		{
+			ShowHint (Language, Grid);
+			Language == "Fr" ? cout << "Numéro de la ligne : " 
+							 : cout << "Spot of the line : " ; 
+			if (!WaitForAnswer (Mode)) return false;
+		}
+		cin >> Pos.first; 
+		
+		for (; Pos.first > Grid.GetNbRows () || cin.fail ();) 
+		{
+			cin.clear ();
+			cin.ignore (numeric_limits<streamsize>::max(), '\n');	
+			Language == "Fr" ? cout << "C'est un numéro : " 
+							 : cout << "Enter unsigned : " ; 
+			if (!WaitForAnswer (Mode)) return false;
+			cin >> Pos.first; 
+		}
+		
+		--Pos.first;
+
+		Language == "Fr" ? cout << "Numéro de la colonne : " 
+						 : cout << "Spot of the column : "; 
+		
+		if (!WaitForAnswer (Mode)) return false;
+		cin >> Pos.second; 
+		
+		for (; Pos.second > Grid.GetNbCols () || cin.fail();) 
+		{
+			cin.clear ();
+			cin.ignore (numeric_limits<streamsize>::max(), '\n');	
+			Language == "Fr" ? cout << "C'est un numéro : " 
+							 : cout << "Enter unsigned : "; 
+			if (!WaitForAnswer (Mode)) return false;
+			cin >> Pos.second;
+		}
+		
+		--Pos.second;
+
+		Language == "Fr" ? cout << "Déplacements disponibles :" << endl
+								<< "A - Gauche" << endl
+								<< "Z - Haut" << endl
+								<< "E - Droite" << endl
+								<< "S - Bas" << endl
+						 : cout << "Move available :" << endl
+						 		<< "A - Left " << endl
+						 		<< "Z - Top" << endl
+						 		<< "E - Right" << endl
+						 		<< "S - Bottom" << endl; 
+		if (!WaitForAnswer (Mode)) return false;
+		cin >> Direction;
+		return true;
+	} //ReadMove
+	
+	void PlayWithPrompts (CGame & Game, string Language,
+						  const CGameMode & Mode, CRecorder & Recorder)
+	{
+		unsigned CptTot = 0;
+		CPosition Pos;
+
+		char Direction = 0; 
+
+		Resolve (Game);
+		for (; !Mode.IsOver (Game) && Direction != 'q' ;)
+		{
+			DisplayGrid (Game.Grid);
+			if (!NombreCombiRestante (CptTot, Game.Grid)) break;
+			cout << Mode.GetStatus (Game, Language == "Fr") << endl;
+			Language == "Fr" ? cout << "Il reste : " << CptTot 
+									<< " combinaisons possible" << endl 
+							 : cout << CptTot << " combo remaining" << endl;
+
+			bool Read;
+			{
+				NC_STAGE (KStageWait);
+				Read = ReadMove (Language, Game.Grid, Mode, Pos, Direction);
+			}
+			if (!Read) break;
+			NC_COUNT (KStageWait, 1);
+			
+			if (TestMove (Game.Grid, Pos, Direction))
+			{
+				MakeAMove (Game, Pos, Direction, Recorder);
+			}
+			// Le coup est compté avant de savoir si la partie est finie,
+			//  comme au rejeu
+			Resolve (Game);
+		}
+	} //PlayWithPrompts
+	
+	// Deux jeux lancés dans la même seconde n'ont pas la même grille
+	uint64_t NewSeed ()
+	{
+		uint64_t Seed = uint64_t (time (NULL)) << 32 ^ getpid ();
+		random_device Device;
+		return Seed ^ (uint64_t (Device ()) << 32 | Device ());
+	} //NewSeed
+
+	void NumberCrushV1 (string Language, string Difficulty,
+						CGameMode & Mode)
+	{
+		CDifficulty Params;
+		GetDifficulty (Difficulty, Params);
+		if (GameMoves) Params.NbMove = GameMoves;
+
+		CGame Game;
+		InitGame (Game, Params, GameSeed ? GameSeed : NewSeed ());
+		Mode.Start (Params);
+		ResetCounters ();
+		CRecorder Recorder;
+		Recorder.Start (Game.Seed, Mode.GetId (), GetLevel (Difficulty),
+						Params.NbMove);
+
+		// Au clavier sur un terminal, sinon question par question
+		if (!PlayInteractive (Game, Screen, Language, Mode, Recorder,
+							  Hints))
+			PlayWithPrompts (Game, Language, Mode, Recorder);
+
+		Language == "Fr" ? cout << "Fin de partie" << endl : 
+						   cout << "End of game" << endl; 
+
+		// La durée retenue est enregistrée : le rejeu retrouve le score
+		const unsigned Ecart = Mode.GetElapsed ();
+		unsigned Score = Mode.GetScore (Game, Ecart);
+		Recorder.Finish (Ecart, Score);
+		string Path;
+		if (!RecordDir.empty () &&
+			!SaveReplay (RecordDir + "/" + to_string (Game.Seed),
+						 Recorder.GetReplay (), Path))
+			cout << "Partie non enregistree / Game not recorded" << endl;
+		ScoreBoard (Score, Mode, Difficulty);
+
+		// Où est passé le temps de chaque tour, si compté
+		PrintCounters (cout);
+	} //NumberCrushV1
+
+	void GameOptions (string & Language, string & Difficulty)
+	{
+		char ModOptions; 
+		for (char Choice; Choice != 'q' && Choice != 'Q';)
+		{
+			/* Affichage du menu de modification des options en Français
+			 *  ou en Anglais (tout dépend de la valeur 
+			 * du paramètre Language)*/ 			
+			ClearScreen ();
+			DisplayLogo (); 
+			Language == "Fr" ? cout << endl
+									<< "D - Modifier la difficulté" << endl
+									<< "L - Modifier le langage "
+									   "( 1 : Fr / 2 : En )" << endl
+									<< "Q - Retour au menu" << endl
+							 : cout << endl
+							   		<< "D - Change difficulty" << endl
+							   		<< "L - Change language "
+									   "( 1 : Fr / 2 : En )" << endl
+							   		<< "Q - Exit options" << endl; 
+			cin >> Choice; 
+
+			// Choix de modification d'une option
+			switch (Choice)
+			{
+			  case 'L':
+			  case 'l': 
+				cin >> ModOptions; 
+				ModOptions == '1' ? Language ="Fr" : Language = "En"; 
+				break; 
+
+			  case 'D':
+			  case 'd': 
+				cout << endl; 
+				Language == "Fr" ? cout << " Modifier la difficulté : " 
+									    << endl 
+										<< " E - Facile" << endl
+										<< " M - Moyen" << endl
+										<< " H - Difficile" << endl
+							     : cout << " Change difficulty : " << endl
+										<< " E - Easy" << endl 
+										<< " M - Medium" << endl 
+										<< " H - Hard" << endl; 
+				cin >> ModOptions; 
+				switch(ModOptions)
+				{
+				  case 'E':
+				  case 'e': 
+					Difficulty = "Easy";
+					cout << endl; 
+					break; 
+
+				  case 'M':
+				  case 'm': 
+					Difficulty = "Medium";
+					cout << endl;
+					break; 
+
+				  case 'H':
+				  case 'h':
+					Difficulty = "Hard"; 
+					cout << endl; 
+					break; 
+
+				  default: 
+					Language == "Fr" ? cerr << "Saisie incorrecte" << endl
+									 : cerr << "Invalid entry" << endl; 
+				}
+
+			  case 'Q':
+			  case 'q': 
+				break;
+
+			  default:
+				Language == "Fr" ? cerr << "Saisie incorrecte" << endl
+								 : cerr << "Invalid entry" << endl; 
+			}
+		}
+	} //GameOptions
+
+	void Help (string Language, const CGameMode & Mode)
+	{
+		cout << GetAsset (Mode.GetHelp (Language == "Fr"));
+	} //Help
+
+	void StartMenu () 
+	{
+		string Lang = "Fr"; 
+		string Difficulty = "Easy";
+
+		// Les deux modes sont dans le même exécutable, C passe de l'un
+		//  à l'autre
+		CStandardMode Standard;
+		CChronoMode   Chrono;
+		CGameMode *   Mode  = &Standard;
+		CGameMode *   Other = &Chrono;
+
+		ClearScreen (); 
+		DisplayLogo (); 
+
+		char Choice;
+		while (Choice != 'q' || Choice != 'Q')
+		{ 
+			Lang == "Fr" ? cout << endl
+						   	    << "S - Commencer une partie" << endl
+						   	    << "C - Changer en mode "
+								<< Other->GetName (true) << endl 
+						  		<< "O - Personnaliser les options" << endl
+						   		<< "H - Aide" << endl
+						   		<< "Q - Quitter" << endl
+						 : cout << endl
+						   		<< "S - Start a game" << endl
+						   		<< "C - Change for "
+								<< Other->GetName (false) << " mode" << endl
+						   		<< "O - Change settings" << endl
+						   		<< "H - Help" << endl 
+						   		<< "Q - Leave the game" << endl; 
+
+			cin >> Choice; 
+
+			switch (Choice) 
+			{
+			  case 's':
+			  case 'S': 
+				NumberCrushV1 (Lang, Difficulty, *Mode);  
+				break; 
+
+			  case 'o':
+			  case 'O':
+				GameOptions (Lang, Difficulty);
+				break;  
+
+			  case 'h': 
+			  case 'H': 
+				Help (Lang, *Mode); 
+				break; 
+
+			  case 'q':
+			  case 'Q': 
+				cout << "A bientôt! / Good bye!" << endl; 
+				break; 
+			  case 'c':
+			  case 'C': 
+				swap (Mode, Other);
+				ClearScreen ();
+				DisplayLogo ();
+				break;
+			  default: 
+				cout << "Choix incorrect / Unkown command" << endl; 
+			}
+			if (Choice == 'Q' || Choice == 'q') break;
+		}
+	} //StartMenu
+	void ScoreBoard (unsigned Score, const CGameMode & Mode,
+					 const string & Difficulty)
+	{
+		string Pseudo;
+		cout << "Entrez votre pseudo / Enter Player id : " << endl;
+		cin >> Pseudo;
+		ClearScreen();
+
+		// score.log garde toutes les parties, score.idx les meilleures
+		CScoreStore Store ("score");
+		CScoreRecord Record;
+		MakeScoreRecord (Record, Pseudo, Score, Mode.GetId (),
+						 GetLevel (Difficulty), time (NULL));
+		unsigned Rank = 0;
+		if (!Store.Add (Record, &Rank))
+			cout << "Score non enregistre / Score not saved" << endl;
+
+		// Recopiés de score.idx, sans une allocation par ligne ; un
+		//  index en cours d'écriture est relu un peu plus tard
+		CScoreRecord Top [KTopScores];
+		unsigned NbTop = 0;
+		bool IsRead = false;
+		for (unsigned Try = 0; Try < KNbBoardTries && !IsRead; ++Try)
+		{
+			if (Try) this_thread::sleep_for (chrono::milliseconds (20));
+			IsRead = Store.GetTop (Mode.GetId (), GetLevel (Difficulty),
+								   Top, NbTop);
+		}
+		cout << "Meilleurs scores / High scores : " << Mode.GetName (false)
+			 << ", " << Difficulty << endl << "---------------" << endl;
+		if (!IsRead)
+			cout << "Indisponibles / Unavailable" << endl;
+		for (unsigned i = 0; i < NbTop; ++i)
+		{
+			const unsigned Length = GetPseudoLength (Top [i]);
+			cout << setw (2) << i + 1 << ". ";
+			cout.write (Top [i].Pseudo, Length)
+				<< setw (KPseudoLength - Length + 9) << Top [i].Score
+				<< (i + 1 == Rank ? " <" : "") << endl;
+		}
+		cout << "---------------" << endl;
+		if (0 == Rank)
+			cout << setw (10) << Pseudo << endl << setw (9) << Score << endl;
+	} //ScoreBoard
+
+	bool RunReplay (const string & Path, bool RealTime)
+	{
+		CReplay Replay;
+		if (!LoadReplay (Path, Replay))
+		{
+			cout << Path << " : not a replay" << endl;
+			return false;
+		}
+		CStandardMode Standard;
+		CChronoMode   Chrono;
+		const CGameMode & Mode = Chrono.GetId () == Replay.Mode
+								 ? (const CGameMode &) Chrono : Standard;
+
+		CGame Game;
+		StartReplay (Game, Replay);
+		const chrono::steady_clock::time_point Start =
+			chrono::steady_clock::now ();
+		if (RealTime) ClearScreen ();
+
+		unsigned NbPlayed = 0;
+		for (; NbPlayed < Replay.Moves.size (); ++NbPlayed)
+		{
+			const CReplayMove & Move = Replay.Moves [NbPlayed];
+			if (RealTime)
+			{
+				// Le numéro déplacé en surbrillance, au moment où il l'a été
+				Screen.Update (GetAsset ("logo"), Game.Grid, 1, "Score : " +
+							   to_string (Game.Score) + "\n", Move.Pos);
+				this_thread::sleep_until (Start +
+										  chrono::milliseconds (Move.Time));
+			}
+			if (!ReplayMove (Game, Move)) break;
+		}
+		if (RealTime)
+			Screen.Update (GetAsset ("logo"), Game.Grid, 1, "Score : " +
+						   to_string (Game.Score) + "\n");
+
+		const unsigned Score = Mode.GetScore (Game, Replay.Ecart);
+		cout << Path << " : seed " << Replay.Seed << ", " << NbPlayed
+			 << " / " << Replay.Moves.size () << " moves, score " << Score;
+		if (NbPlayed < Replay.Moves.size ())
+			cout << " : move " << NbPlayed + 1 << " refused" << endl;
+		else if (Score != Replay.Score)
+			cout << ", recorded " << Replay.Score << " : MISMATCH" << endl;
+		else
+			cout << " : OK" << endl;
+		return NbPlayed == Replay.Moves.size () && Score == Replay.Score;
+	} //RunReplay
+
+	void Usage (const char * Name)
+	{
+		cerr << "Usage : " << Name << " [--record Dir] [--seed S]"
+			 << " [--moves M <= " << KMaxMoveLimit << "]" << endl
+			 << "        " << Name << " --replay [--real-time] File..."
+			 << endl;
+		exit (1);
+	} //Usage
+} //namespace
+
+int main (int argc, char * argv [])
+{
+	// cin lit lui-même l'entrée : WaitForInput voit ce qui est déjà tapé
+	ios::sync_with_stdio (false);
+
+	bool IsReplay = false;
+	bool RealTime = false;
+	vector <string> Replays;
+	for (int i = 1; i < argc; ++i)
+	{
+		const string Arg = argv [i];
+		if ("--record" == Arg && i + 1 < argc && !IsReplay)
+			RecordDir = argv [++i];
+		else if ("--seed" == Arg && i + 1 < argc && !IsReplay)
+			GameSeed = strtoull (argv [++i], 0, 10);
+		else if ("--moves" == Arg && i + 1 < argc && !IsReplay)
+		{
+			// Au-delà, la partie enregistrée ne saurait plus sa limite
+			const unsigned long Moves = strtoul (argv [++i], 0, 10);
+			if (Moves > KMaxMoveLimit) Usage (argv [0]);
+			GameMoves = Moves;
+		}
+		else if ("--replay" == Arg)
+			IsReplay = true;
+		else if ("--real-time" == Arg && IsReplay)
+			RealTime = true;
+		else if (IsReplay && Arg.compare (0, 2, "--") != 0)
+			Replays.push_back (Arg);
+		else
+			Usage (argv [0]);
+	}
+	if (IsReplay)
+	{
+		// Une ligne par partie ; le code de retour dit si toutes sont justes
+		if (Replays.empty ()) Usage (argv [0]);
+		bool AllOk = true;
+		for (unsigned i = 0; i < Replays.size (); ++i)
+			AllOk = RunReplay (Replays [i], RealTime) && AllOk;
+		return AllOk ? 0 : 1;
+	}
+
+	ClearScreen ();
+	cout << endl; 
+	StartMenu (); 
+	cout << endl; 
+
+	return 0; 
+} //main
@@ -0,0 +1,274 @@
+/**
+*
+* @file NumberCrushSim.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Parties jouées en masse, sans terminal, sur tous les coeurs
+*
+* numbercrush-sim [--games N] [--threads T]
+*                 [--policy random|greedy|lookahead|hint]
+*                 [--difficulty Easy|Medium|Hard] [--mode standard|chrono]
+*                 [--size S] [--candies C] [--moves M] [--time S]
+*                 [--think S] [--seed S] [--budget US]
+*
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Engine.h"
+#include "Policy.h"
+#include "ThreadPool.h"
+
+using namespace std;
+using namespace nsNumberCrush;
+
+namespace
+{
+	typedef unsigned long long ULL;
+
+	const unsigned KGamesPerTask = 64;
+	const unsigned KMaxDepth     = 16; // profondeurs >= KMaxDepth regroupées
+	const unsigned KNbBars       = 10;
+
+/**
+ * \struct CSimParams
+ * \brief What to simulate, from the command line
+ *
+ */
+	struct CSimParams
+	{
+		ULL         NbGames;
+		unsigned    NbThreads;
+		string      Policy;
+		bool        Chrono;
+		unsigned    Think;   ///< Seconds the simulated player spends per move
+		unsigned    Budget;  ///< Microseconds per move of "hint", 0 : none
+		ULL         Seed;    ///< Game g is started with Seed + g
+		CDifficulty Difficulty;
+	}; // CSimParams
+
+/**
+ * \struct CStats
+ * \brief Results of a batch of games
+ *
+ */
+	struct CStats
+	{
+		ULL               NbMoves;
+		vector <unsigned> Scores;  ///< Final score of every game
+		vector <ULL>      Depths;  ///< Moves per cascade depth
+
+		CStats () : NbMoves (0), Depths (KMaxDepth + 1, 0) {}
+	}; // CStats
+
+	void Usage (const char * Name)
+	{
+		cerr << "Usage : " << Name << " [--games N] [--threads T]" << endl
+			 << "  [--policy random|greedy|lookahead|hint]" << endl
+			 << "  [--difficulty Easy|Medium|Hard] [--mode standard|chrono]"
+			 << endl
+			 << "  [--size S] [--candies C] [--moves M] [--time S]" << endl
+			 << "  [--think S] [--seed S] [--budget US]" << endl;
+		exit (1);
+	} // Usage
+
+	void ParseArgs (int argc, char * argv [], CSimParams & Params)
+	{
+		Params.NbGames   = 10000;
+		Params.NbThreads = 0;
+		Params.Policy    = "greedy";
+		Params.Chrono    = false;
+		Params.Think     = 2;
+		Params.Budget    = KHintBudget;
+		Params.Seed      = time (NULL);
+		GetDifficulty ("Easy", Params.Difficulty);
+
+		// Les options de difficulté s'appliquent après --difficulty
+		string Difficulty = "Easy";
+		vector <pair <string, unsigned> > Overrides;
+
+		for (int i = 1; i < argc; ++i)
+		{
+			const string Arg = argv [i];
+			if (i + 1 >= argc) Usage (argv [0]);
+			const string Value = argv [++i];
+
+			if      (Arg == "--games")      Params.NbGames = strtoull (
+												Value.c_str (), 0, 10);
+			else if (Arg == "--threads")    Params.NbThreads = atoi (
+												Value.c_str ());
+			else if (Arg == "--policy")     Params.Policy = Value;
+			else if (Arg == "--difficulty") Difficulty = Value;
+			else if (Arg == "--mode")       Params.Chrono = Value == "chrono";
+			else if (Arg == "--think")      Params.Think = atoi (
+												Value.c_str ());
+			else if (Arg == "--seed")       Params.Seed = strtoull (
+												Value.c_str (), 0, 10);
+			else if (Arg == "--budget")     Params.Budget = atoi (
+												Value.c_str ());
+			else if (Arg == "--size"  || Arg == "--candies" ||
+					 Arg == "--moves" || Arg == "--time")
+				Overrides.push_back (make_pair (Arg, atoi (Value.c_str ())));
+			else
+				Usage (argv [0]);
+		}
+
+		GetDifficulty (Difficulty, Params.Difficulty);
+		for (unsigned i = 0; i < Overrides.size (); ++i)
+		{
+			const string & Arg = Overrides [i].first;
+			const unsigned Value = Overrides [i].second;
+			if      (Arg == "--size")    Params.Difficulty.Size      = Value;
+			else if (Arg == "--candies") Params.Difficulty.NbCandies = Value;
+			else if (Arg == "--moves")   Params.Difficulty.NbMove    = Value;
+			else                         Params.Difficulty.TimeLimit = Value;
+		}
+
+		if (Params.Difficulty.NbCandies < 1 ||
+			Params.Difficulty.NbCandies > KMaxCandies)
+		{
+			cerr << "--candies : 1 to " << KMaxCandies << endl;
+			exit (1);
+		}
+		// En mode chrono, seul le temps limite la partie
+		if (Params.Chrono) Params.Difficulty.NbMove = ~0u;
+
+		unique_ptr <CPolicy> Check (MakePolicy (Params.Policy, 0));
+		if (!Check)
+		{
+			cerr << "Unknown policy : " << Params.Policy << endl;
+			exit (1);
+		}
+	} // ParseArgs
+
+	void PlayGame (const CSimParams & Params, ULL Seed, CStats & Stats)
+	{
+		unique_ptr <CPolicy> Policy (MakePolicy (Params.Policy,
+												 MixSeed (Seed),
+												 Params.Budget));
+		CGame Game;
+		InitGame (Game, Params.Difficulty, Seed);
+		Resolve (Game);
+
+		unsigned Ecart = 0;
+		for (CMove Move; ; )
+		{
+			if (Params.Chrono ? (Ecart >= unsigned (Params.Difficulty.TimeLimit)
+								 || !AnyMove (Game.Grid))
+							  : IsOver (Game))
+				break;
+			if (!Policy->Choose (Game, Move)) break;
+
+			ApplyMove (Game, Move.Pos, Move.Direction);
+			Ecart += Params.Think;
+			++Stats.NbMoves;
+
+			Resolve (Game);
+			++Stats.Depths [min <size_t> (Game.Cascade.Steps.size (),
+										  KMaxDepth)];
+		}
+
+		Stats.Scores.push_back (Params.Chrono ? ChronoScore (Game, Ecart)
+											  : StandardScore (Game, Ecart));
+	} // PlayGame
+
+	void Report (const CSimParams & Params, unsigned NbThreads,
+				 double Elapsed, vector <CStats> & Batches)
+	{
+		CStats All;
+		for (unsigned i = 0; i < Batches.size (); ++i)
+		{
+			All.NbMoves += Batches [i].NbMoves;
+			All.Scores.insert (All.Scores.end (), Batches [i].Scores.begin (),
+							   Batches [i].Scores.end ());
+			for (unsigned d = 0; d <= KMaxDepth; ++d)
+				All.Depths [d] += Batches [i].Depths [d];
+		}
+		vector <unsigned> & Scores = All.Scores;
+		if (Scores.empty ()) return;
+		sort (Scores.begin (), Scores.end ());
+
+		ULL Sum = 0;
+		for (unsigned i = 0; i < Scores.size (); ++i) Sum += Scores [i];
+		const unsigned Min = Scores.front ();
+		const unsigned Max = Scores.back ();
+
+		cout << fixed << setprecision (1)
+			 << "games       : " << Scores.size () << endl
+			 << "threads     : " << NbThreads << endl
+			 << "policy      : " << Params.Policy;
+		if (Params.Policy == "hint")
+			Params.Budget ? cout << ", " << Params.Budget << " us per move"
+						  : cout << ", no time limit";
+		cout << endl
+			 << "elapsed     : " << Elapsed << " s" << endl
+			 << "games/sec   : " << Scores.size () / Elapsed << endl
+			 << "moves/game  : " << double (All.NbMoves) / Scores.size ()
+			 << endl << endl
+			 << "score       : min " << Min
+			 << "  mean " << double (Sum) / Scores.size ()
+			 << "  max " << Max << endl
+			 << "              p10 " << Scores [Scores.size () / 10]
+			 << "  p50 " << Scores [Scores.size () / 2]
+			 << "  p90 " << Scores [Scores.size () * 9 / 10] << endl;
+
+		const unsigned Step = (Max - Min) / KNbBars + 1;
+		vector <ULL> Bars (KNbBars, 0);
+		for (unsigned i = 0; i < Scores.size (); ++i)
+			++Bars [(Scores [i] - Min) / Step];
+		for (unsigned b = 0; b < KNbBars; ++b)
+			cout << setw (10) << Min + b * Step << " - "
+				 << setw (10) << Min + (b + 1) * Step - 1 << " : "
+				 << setw (5) << 100.0 * Bars [b] / Scores.size () << " % "
+				 << string (50 * Bars [b] / Scores.size (), '#') << endl;
+
+		cout << endl << "cascade depth (moves)" << endl;
+		for (unsigned d = 0; d <= KMaxDepth; ++d)
+		{
+			if (0 == All.Depths [d]) continue;
+			cout << setw (4) << d << (d == KMaxDepth ? "+" : " ") << " : "
+				 << setw (12) << All.Depths [d] << "  " << setw (5)
+				 << 100.0 * All.Depths [d] / (All.NbMoves ? All.NbMoves : 1)
+				 << " %" << endl;
+		}
+	} // Report
+
+} // namespace
+
+int main (int argc, char * argv [])
+{
+	CSimParams Params;
+	ParseArgs (argc, argv, Params);
+
+	const ULL NbTasks = (Params.NbGames + KGamesPerTask - 1) / KGamesPerTask;
+	vector <CStats> Batches (NbTasks);
+
+	CThreadPool Pool (Params.NbThreads);
+	const chrono::steady_clock::time_point Debut = chrono::steady_clock::now ();
+	for (ULL t = 0; t < NbTasks; ++t)
+		Pool.Submit ([t, &Params, &Batches] ()
+		{
+			const ULL First = t * KGamesPerTask;
+			const ULL Last  = min (Params.NbGames, First + KGamesPerTask);
+			for (ULL g = First; g < Last; ++g)
+				PlayGame (Params, Params.Seed + g, Batches [t]);
+		});
+	Pool.Wait ();
+	const double Elapsed = chrono::duration <double> (
+		chrono::steady_clock::now () - Debut).count ();
+
+	Report (Params, Pool.GetNbThreads (), Elapsed, Batches);
+
+	return 0;
+} // main
@@ -0,0 +1,188 @@
+/**
+*
+* @file Play.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Partie jouée au clavier : curseur, échange en une touche
+*
+*/
+
+#include <cctype>
+#include <iostream>
+#include <sstream>
+
+#include "Assets.h"
+#include "Counters.h"
+#include "Input.h"
+#include "Play.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		// Lignes sous la grille : état, combinaisons, touches, message
+		const unsigned KNbFooterLines = 5;
+
+		// Rafraîchissement du chrono, en ms
+		const int KTickDelay = 100;
+
+		string Footer (const CGame & Game, bool Fr, unsigned CptTot,
+					   const CGameMode & Mode, bool Selected,
+					   const string & Message)
+		{
+			ostringstream Text;
+			Text << "Score : " << Game.Score << "    "
+				 << Mode.GetStatus (Game, Fr) << '\n';
+
+			Fr ? Text << "Il reste : " << CptTot
+					  << " combinaisons possible" << '\n'
+			   : Text << CptTot << " combo remaining" << '\n';
+
+			Text << (Fr ? "Flèches : curseur  A Z E S : échanger  "
+						  "Espace : choix  H : indice  Q : quitter"
+						: "Arrows : cursor  A Z E S : swap  "
+						  "Space : select  H : hint  Q : quit") << '\n';
+
+			if (!Message.empty ())
+				Text << Message << '\n';
+			else if (Selected)
+				Text << (Fr ? "Flèche : sens de l'échange"
+							: "Arrow : direction of the swap") << '\n';
+			return Text.str ();
+		} // Footer
+
+		// Déplace le curseur d'une case, sans sortir de la grille
+		void MoveCursor (CPosition & Cursor, char Direction,
+						 const CGrid & Grid)
+		{
+			CPosition Other;
+			if (Neighbour (Grid, Cursor, Direction, Other)) Cursor = Other;
+		} // MoveCursor
+
+		char ArrowDirection (CEventType Type)
+		{
+			switch (Type)
+			{
+			  case KUp    : return 'Z';
+			  case KDown  : return 'S';
+			  case KLeft  : return 'A';
+			  case KRight : return 'E';
+			  default     : return 0;
+			}
+		} // ArrowDirection
+
+		string HintMessage (const CHint & Hint, bool Fr)
+		{
+			ostringstream Text;
+			Fr ? Text << "Indice : " << Hint.Move.Direction << ", "
+					  << Hint.Gain << " points en " << Hint.Depth
+					  << " coups"
+			   : Text << "Hint : " << Hint.Move.Direction << ", "
+					  << Hint.Gain << " points in " << Hint.Depth
+					  << " moves";
+			return Text.str ();
+		} // HintMessage
+
+	} // namespace
+
+	bool PlayInteractive (CGame & Game, CScreen & Screen,
+						  const string & Language, const CGameMode & Mode,
+						  CRecorder & Recorder, CHintEngine & Hints)
+	{
+		CKeyboard Keyboard;
+		if (!Keyboard.IsRaw ()) return false;
+
+		const bool Fr = Language == "Fr";
+		CPosition  Cursor (0, 0);
+		bool       Selected = false;
+		string     Message;
+		unsigned   CptTot = 0;
+		bool       HasMove = false;
+		const int  Timeout = Mode.GetTimer () ? KTickDelay : -1;
+
+		// Le curseur du terminal est caché, celui de la grille suffit
+		cout << "\033[?25l";
+		for (bool Changed = true; ; )
+		{
+			if (Changed)
+			{
+				Resolve (Game);
+				HasMove = NombreCombiRestante (CptTot, Game.Grid);
+				Changed = false;
+			}
+			const bool Over = !HasMove || Mode.IsOver (Game);
+			Screen.Update (GetAsset ("logo"), Game.Grid, KNbFooterLines,
+						   Footer (Game, Fr, CptTot, Mode, Selected, Message),
+						   Over ? KNoCursor : Cursor);
+			if (Over) break;
+
+			CEvent Event;
+			{
+				NC_STAGE (KStageWait);
+				Event = Keyboard.Wait (Timeout);
+			}
+			if (KTick == Event.Type) continue;
+			NC_COUNT (KStageWait, 1);
+			Message.clear ();
+
+			char Direction = ArrowDirection (Event.Type);
+			if (KKey == Event.Type)
+			{
+				const char Key = toupper (Event.Key);
+				if ('Q' == Key)
+				{
+					Game.Score = 0;
+					Recorder.Record (Cursor, KGiveUp);
+					break;
+				}
+				CHint Hint;
+				if ('H' == Key && Hints.FindHint (Game.Grid, Hint))
+				{
+					Cursor   = Hint.Move.Pos;
+					Selected = false;
+					Message  = HintMessage (Hint, Fr);
+					continue;
+				}
+				if ('H' == Key)
+				{
+					Message = Fr ? KNoHintFr : KNoHintEn;
+					continue;
+				}
+				if (' ' == Key || '\n' == Key || '\r' == Key)
+				{
+					Selected = !Selected;
+					continue;
+				}
+				if ('A' == Key || 'Z' == Key || 'E' == Key || 'S' == Key)
+				{
+					Direction = Key;
+					Selected  = true;
+				}
+			}
+			if (KEnd == Event.Type) break;
+			if (0 == Direction) continue;
+
+			if (!Selected)
+			{
+				MoveCursor (Cursor, Direction, Game.Grid);
+				continue;
+			}
+			Selected = false;
+			if (ApplyMove (Game, Cursor, Direction))
+			{
+				Recorder.Record (Cursor, Direction);
+				Changed = true;
+			}
+			else
+				Message = "Impossible";
+		}
+		cout << "\033[?25h" << flush;
+		return true;
+	} // PlayInteractive
+
+} // namespace nsNumberCrush
@@ -0,0 +1,53 @@
+/**
+*
+* @file Play.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Partie jouée au clavier : curseur, échange en une touche
+*
+*/
+
+#ifndef __PLAY_H__
+#define __PLAY_H__
+
+#include <string>
+
+#include "Engine.h"
+#include "Mode.h"
+#include "Hint.h"
+#include "Render.h"
+#include "Replay.h"
+
+namespace nsNumberCrush
+{
+/**
+ * \fn bool PlayInteractive (CGame & Game, CScreen & Screen,
+ *  const std::string & Language, const CGameMode & Mode,
+ *  CRecorder & Recorder, CHintEngine & Hints)
+ * \brief Play Game until its end with the keyboard in raw mode
+ *
+ * The arrow keys move a cursor over the grid ; A, Z, E or S swap the
+ *  number under the cursor with its left, top, right or bottom
+ *  neighbour. Space selects the number, the next arrow key then swaps
+ *  it. H moves the cursor to the number Hints advises to swap. Q gives
+ *  up the game and sets the score to 0. When Mode plays against a clock,
+ *  its status is redrawn ten times a second.
+ *
+ * \param Language "Fr" or anything else for English
+ * \param Mode Started already : tells when the game is over
+ * \param Recorder Told about each swap played, and about Q
+ * \param Hints Searches the move shown by H
+ * \return false, without playing, if stdin is not a terminal
+ *
+ */
+	bool PlayInteractive (CGame & Game, CScreen & Screen,
+						  const std::string & Language,
+						  const CGameMode & Mode, CRecorder & Recorder,
+						  CHintEngine & Hints);
+
+} // namespace nsNumberCrush
+
+#endif /* __PLAY_H__ */
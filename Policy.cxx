@@ -0,0 +1,83 @@
+/**
+*
+* @file Policy.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Stratégies de choix du déplacement, pour jouer sans joueur
+*
+*/
+
+#include "Policy.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	bool CRandomPolicy::Choose (const CGame & Game, CMove & Move)
+	{
+		FindMoves (Game.Grid, m_Moves);
+		if (m_Moves.empty ()) return false;
+		Move = m_Moves [m_Rng.Below (m_Moves.size ())];
+		return true;
+	} // Choose
+
+	unsigned CLookaheadPolicy::BestGain (const CGrid & Grid, unsigned Depth,
+										 CMove * Best) const
+	{
+		vector <CMove> Moves;
+		FindMoves (Grid, Moves);
+
+		// Grid est stable : seules les deux cases échangées sont à revoir
+		vector <CPosition> Swapped (2);
+		unsigned Max = 0;
+		for (unsigned i = 0; i < Moves.size (); ++i)
+		{
+			CGrid Next (Grid);
+			Swapped [0] = Moves [i].Pos;
+			Neighbour (Next, Swapped [0], Moves [i].Direction, Swapped [1]);
+			Next.Swap (Swapped [0], Swapped [1]);
+
+			unsigned Gain = 0;
+			Resolve (Next, Gain, Swapped);
+			if (Depth > 1) Gain += BestGain (Next, Depth - 1, 0);
+
+			// A gain égal, le premier déplacement trouvé est gardé
+			if (Gain > Max || (0 == i))
+			{
+				Max = Gain;
+				if (Best) *Best = Moves [i];
+			}
+		}
+		return Max;
+	} // BestGain
+
+	bool CLookaheadPolicy::Choose (const CGame & Game, CMove & Move)
+	{
+		if (!AnyMove (Game.Grid)) return false;
+		BestGain (Game.Grid, m_Depth ? m_Depth : 1, &Move);
+		return true;
+	} // Choose
+
+	bool CHintPolicy::Choose (const CGame & Game, CMove & Move)
+	{
+		CHint Hint;
+		if (!m_Engine.FindHint (Game.Grid, Hint)) return false;
+		Move = Hint.Move;
+		return true;
+	} // Choose
+
+	CPolicy * MakePolicy (const string & Name, uint64_t Seed,
+						  unsigned HintBudget)
+	{
+		if (Name == "random")    return new CRandomPolicy (Seed);
+		if (Name == "greedy")    return new CLookaheadPolicy (1);
+		if (Name == "lookahead") return new CLookaheadPolicy (2);
+		if (Name == "hint")      return new CHintPolicy (KHintDepth,
+														 HintBudget);
+		return 0;
+	} // MakePolicy
+
+} // namespace nsNumberCrush
@@ -0,0 +1,119 @@
+/**
+*
+* @file Policy.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Stratégies de choix du déplacement, pour jouer sans joueur
+*
+*/
+
+#ifndef __POLICY_H__
+#define __POLICY_H__
+
+#include <string>
+#include <vector>
+
+#include "Engine.h"
+#include "Hint.h"
+
+namespace nsNumberCrush
+{
+/**
+ * \class CPolicy
+ * \brief Chooses the next move of a game ; one instance per game,
+ *  never shared between threads
+ *
+ */
+	class CPolicy
+	{
+	  public :
+		virtual ~CPolicy () {}
+
+/**
+ * \fn bool Choose (const CGame & Game, CMove & Move)
+ * \brief Pick a move among the ones that align something
+ * \param Game A resolved game : nothing is aligned in its grid
+ * \return false if there is none
+ *
+ */
+		virtual bool Choose (const CGame & Game, CMove & Move) = 0;
+
+	}; // CPolicy
+
+/**
+ * \class CRandomPolicy
+ * \brief Any move that aligns something, uniformly
+ *
+ */
+	class CRandomPolicy : public CPolicy
+	{
+		CRandom             m_Rng;
+		std::vector <CMove> m_Moves;
+
+	  public :
+		explicit CRandomPolicy (std::uint64_t Seed) : m_Rng (Seed) {}
+		virtual bool Choose (const CGame & Game, CMove & Move);
+
+	}; // CRandomPolicy
+
+/**
+ * \class CLookaheadPolicy
+ * \brief Move that earns the most points (cascades included) over the
+ *  next Depth moves ; Depth 1 is the greedy policy
+ *
+ */
+	class CLookaheadPolicy : public CPolicy
+	{
+		unsigned m_Depth;
+
+		unsigned BestGain (const CGrid & Grid, unsigned Depth,
+						   CMove * Best) const;
+
+	  public :
+		explicit CLookaheadPolicy (unsigned Depth = 2) : m_Depth (Depth) {}
+		virtual bool Choose (const CGame & Game, CMove & Move);
+
+	}; // CLookaheadPolicy
+
+/**
+ * \class CHintPolicy
+ * \brief The move the hint of the game would show
+ *
+ */
+	class CHintPolicy : public CPolicy
+	{
+		CHintEngine m_Engine;
+
+	  public :
+/**
+ * \fn CHintPolicy (unsigned Depth = KHintDepth,
+ *  unsigned Budget = KHintBudget)
+ * \brief Same parameters as CHintEngine ; without a budget (0), the games
+ *  do not depend on the speed of the machine
+ *
+ */
+		explicit CHintPolicy (unsigned Depth = KHintDepth,
+							  unsigned Budget = KHintBudget)
+			: m_Engine (Depth, Budget, KPolicyTableBits) {}
+		virtual bool Choose (const CGame & Game, CMove & Move);
+
+	}; // CHintPolicy
+
+/**
+ * \fn CPolicy * MakePolicy (const std::string & Name, std::uint64_t Seed,
+ *  unsigned HintBudget = KHintBudget)
+ * \brief Build the policy called "random", "greedy", "lookahead" or
+ *  "hint"
+ * \param HintBudget Microseconds per move of "hint", 0 for no limit
+ * \return A new policy the caller must delete, or 0 if Name is unknown
+ *
+ */
+	CPolicy * MakePolicy (const std::string & Name, std::uint64_t Seed,
+						  unsigned HintBudget = KHintBudget);
+
+} // namespace nsNumberCrush
+
+#endif /* __POLICY_H__ */
@@ -0,0 +1,68 @@
+/**
+*
+* @file Random.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Générateur pseudo-aléatoire propre à chaque partie
+*
+*/
+
+#include "Random.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	uint64_t MixSeed (uint64_t Seed)
+	{
+		uint64_t Z = Seed + 0x9e3779b97f4a7c15ULL;
+		Z = (Z ^ (Z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		Z = (Z ^ (Z >> 27)) * 0x94d049bb133111ebULL;
+		return Z ^ (Z >> 31);
+	} // MixSeed
+
+	void CRandom::SetSeed (uint64_t Seed)
+	{
+		// splitmix64 ne donne jamais quatre mots nuls
+		for (unsigned i = 0; i < 4; ++i)
+			m_State [i] = Seed = MixSeed (Seed);
+	} // SetSeed
+
+	unsigned CRandom::Below (unsigned N)
+	{
+		// Multiplication de Lemire : rejet seulement dans la zone biaisée
+		uint64_t Product = (Next () >> 32) * N;
+		uint32_t Low = uint32_t (Product);
+		if (Low < N)
+		{
+			const uint32_t Threshold = uint32_t (-N) % N;
+			while (Low < Threshold)
+			{
+				Product = (Next () >> 32) * N;
+				Low = uint32_t (Product);
+			}
+		}
+		return unsigned (Product >> 32);
+	} // Below
+
+	void CRandom::Fill (CCell * Cells, size_t Count, unsigned NbCandies)
+	{
+		// Chaque octet tiré est gardé s'il tombe sous le plus grand
+		//  multiple de NbCandies <= 256 : pas de biais, et aucun rejet
+		//  quand NbCandies est une puissance de 2
+		const unsigned Limit = 256 - 256 % NbCandies;
+		for (size_t i = 0; i < Count; )
+		{
+			for (uint64_t Bits = Next (), k = 0; k < 8 && i < Count;
+				 ++k, Bits >>= 8)
+			{
+				const unsigned Byte = unsigned (Bits & 0xff);
+				if (Byte < Limit) Cells [i++] = CCell (Byte % NbCandies + 1);
+			}
+		}
+	} // Fill
+
+} // namespace nsNumberCrush
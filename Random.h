@@ -0,0 +1,94 @@
+/**
+*
+* @file Random.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Générateur pseudo-aléatoire propre à chaque partie
+*
+*/
+
+#ifndef __RANDOM_H__
+#define __RANDOM_H__
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Grid.h"
+
+namespace nsNumberCrush
+{
+/**
+ * \class CRandom
+ * \brief xoshiro256** generator : the same seed always gives the same
+ *  sequence, and each game owns its generator so that parallel games
+ *  neither share nor lock anything
+ *
+ */
+	class CRandom
+	{
+		std::uint64_t m_State [4];
+
+		static std::uint64_t RotL (std::uint64_t X, unsigned K)
+		{
+			return (X << K) | (X >> (64 - K));
+		} // RotL
+
+	  public :
+		explicit CRandom (std::uint64_t Seed = 0) { SetSeed (Seed); }
+
+/**
+ * \fn void SetSeed (std::uint64_t Seed)
+ * \brief Restart the sequence of Seed ; every Seed, 0 included, is valid
+ *
+ */
+		void SetSeed (std::uint64_t Seed);
+
+/**
+ * \fn std::uint64_t Next ()
+ * \brief 64 random bits
+ *
+ */
+		std::uint64_t Next ()
+		{
+			const std::uint64_t Result = RotL (m_State [1] * 5, 7) * 9;
+			const std::uint64_t T = m_State [1] << 17;
+			m_State [2] ^= m_State [0];
+			m_State [3] ^= m_State [1];
+			m_State [1] ^= m_State [2];
+			m_State [0] ^= m_State [3];
+			m_State [2] ^= T;
+			m_State [3]  = RotL (m_State [3], 45);
+			return Result;
+		} // Next
+
+/**
+ * \fn unsigned Below (unsigned N)
+ * \brief Uniform number in [0, N[, without the bias of Next () % N
+ *
+ */
+		unsigned Below (unsigned N);
+
+/**
+ * \fn void Fill (CCell * Cells, std::size_t Count, unsigned NbCandies)
+ * \brief Uniform candies 1..NbCandies in Count cells, eight cells for
+ *  each call to Next ()
+ *
+ */
+		void Fill (CCell * Cells, std::size_t Count, unsigned NbCandies);
+
+	}; // CRandom
+
+/**
+ * \fn std::uint64_t MixSeed (std::uint64_t Seed)
+ * \brief splitmix64 : spreads close seeds (Seed, Seed + 1 ...) apart,
+ *  to derive one seed per game from a single one
+ *
+ */
+	std::uint64_t MixSeed (std::uint64_t Seed);
+
+} // namespace nsNumberCrush
+
+#endif /* __RANDOM_H__ */
@@ -0,0 +1,238 @@
+/**
+*
+* @file Render.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Affichage de la grille image par image sur le terminal
+*
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <iostream>
+
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include "Counters.h"
+#include "Render.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		const int KReset   = 0;
+		const int KRougeF  = 41;
+
+		// Colonnes du terminal avant la première case, et par case
+		const unsigned KLeftMargin = 3;
+		const unsigned KCellWidth  = 4;
+
+		// Nombre de lignes du terminal, 0 si la sortie n'en est pas un
+		unsigned TerminalHeight ()
+		{
+			winsize Size;
+			if (!isatty (STDOUT_FILENO) ||
+				ioctl (STDOUT_FILENO, TIOCGWINSZ, &Size) != 0)
+				return 0;
+			return Size.ws_row;
+		} // TerminalHeight
+
+		void MoveCursor (CFrame & Frame, unsigned Line, unsigned Column)
+		{
+			Frame.Append ("\033[");
+			Frame.AppendNumber (Line);
+			Frame.Append (';');
+			Frame.AppendNumber (Column);
+			Frame.Append ('H');
+		} // MoveCursor
+
+	} // namespace
+
+	CFrame::CFrame (size_t Capacity) : m_Color (-1), m_Reverse (false)
+	{
+		m_Buffer.reserve (Capacity);
+	} // CFrame
+
+	void CFrame::Clear ()
+	{
+		m_Buffer.clear ();
+		m_Color = -1;
+	} // Clear
+
+	void CFrame::ClearScreen ()
+	{
+		m_Buffer += "\033[H\033[2J";
+	} // ClearScreen
+
+	void CFrame::SetColor (int Color, bool Reverse)
+	{
+		if (Color == m_Color && Reverse == m_Reverse) return;
+		m_Color   = Color;
+		m_Reverse = Reverse;
+
+		// "0;" : un fond coloré ne déborde pas sur la couleur suivante
+		m_Buffer += "\033[0";
+		if (Reverse) m_Buffer += ";7";
+		if (Color != KReset)
+		{
+			m_Buffer += ';';
+			AppendNumber (Color);
+		}
+		m_Buffer += 'm';
+	} // SetColor
+
+	void CFrame::AppendNumber (unsigned Value, unsigned Width)
+	{
+		char Digits [16];
+		unsigned NbDigits = 0;
+		do
+		{
+			Digits [NbDigits++] = char ('0' + Value % 10);
+			Value /= 10;
+		} while (Value != 0);
+
+		if (Width > NbDigits) m_Buffer.append (Width - NbDigits, ' ');
+		while (NbDigits != 0) m_Buffer += Digits [--NbDigits];
+	} // AppendNumber
+
+	bool CFrame::Flush ()
+	{
+		NC_COUNT (KStageRender, m_Buffer.size ());
+		cout.flush ();
+
+		const char * Data = m_Buffer.data ();
+		size_t Left = m_Buffer.size ();
+		while (Left != 0)
+		{
+			const ssize_t NbWritten = write (STDOUT_FILENO, Data, Left);
+			if (NbWritten < 0)
+			{
+				if (EINTR == errno) continue;
+				Clear ();
+				return false;
+			}
+			Data += NbWritten;
+			Left -= NbWritten;
+		}
+		Clear ();
+		return true;
+	} // Flush
+
+	int CandyColor (CCell Cell)
+	{
+		// 1 garde la couleur du terminal, 2 à 8 : noir, rouge ... cyan
+		if (0 == Cell) return KRougeF;
+		if (1 == Cell) return KReset;
+		return 28 + Cell;
+	} // CandyColor
+
+	void DrawGrid (CFrame & Frame, const CGrid & Grid,
+				   const CPosition & Cursor)
+	{
+		Frame.SetColor (KReset);
+		Frame.Append ("   ");
+		for (unsigned j = 0; j < Grid.GetNbCols (); ++j)
+			Frame.AppendNumber (j + 1, KCellWidth);
+		Frame.Append ('\n');
+
+		Frame.Append ("   ");
+		for (unsigned j = 0; j < Grid.GetNbCols (); ++j)
+			Frame.Append (string (KCellWidth, '-'));
+		Frame.Append ('\n');
+
+		for (unsigned i = 0; i < Grid.GetNbRows (); ++i)
+		{
+			Frame.AppendNumber (i + 1, KLeftMargin - 1);
+			Frame.Append ('|');
+			for (unsigned j = 0; j < Grid.GetNbCols (); ++j)
+			{
+				Frame.SetColor (CandyColor (Grid (i, j)),
+								Cursor == CPosition (i, j));
+				Frame.AppendNumber (Grid (i, j), KCellWidth);
+			}
+			Frame.SetColor (KReset);
+			Frame.Append ('\n');
+		}
+	} // DrawGrid
+
+	void CScreen::Redraw (const string & Header, const CGrid & Grid,
+						  const CPosition & Cursor)
+	{
+		m_Frame.ClearScreen ();
+		m_Frame.Append (Header);
+		DrawGrid (m_Frame, Grid, Cursor);
+
+		m_Header = Header;
+		m_Shown  = Grid;
+		m_Cursor = Cursor;
+		// Lignes comptées à partir de 1, plus numéros et tirets
+		m_Top    = count (Header.begin (), Header.end (), '\n') + 3;
+		m_Valid  = true;
+	} // Redraw
+
+	bool CScreen::Update (const string & Header, const CGrid & Grid,
+						  unsigned NbFooter, const string & Footer,
+						  const CPosition & Cursor)
+	{
+		NC_STAGE (KStageRender);
+		if (!m_Valid || Header != m_Header ||
+			Grid.GetNbRows () != m_Shown.GetNbRows () ||
+			Grid.GetNbCols () != m_Shown.GetNbCols () ||
+			TerminalHeight () < m_Top + Grid.GetNbRows () + NbFooter)
+		{
+			Redraw (Header, Grid, Cursor);
+			m_Frame.Append (Footer);
+			return m_Frame.Flush ();
+		}
+
+		// Les deux cases du curseur sont réécrites s'il a bougé
+		const CPosition OldCursor = m_Cursor;
+		const bool Moved = Cursor != OldCursor;
+		m_Cursor = Cursor;
+
+		const unsigned NbCols = Grid.GetNbCols ();
+		for (unsigned i = 0; i < Grid.GetNbRows (); ++i)
+		{
+			const CCell * Line  = Grid.GetLine (i);
+			const CCell * Shown = m_Shown.GetLine (i);
+			const bool CursorLine = Moved && (i == Cursor.first ||
+											  i == OldCursor.first);
+			if (!CursorLine && equal (Line, Line + NbCols, Shown)) continue;
+
+			// Le curseur suit l'écriture : pas de déplacement entre deux
+			//  cases voisines qui changent
+			bool Placed = false;
+			for (unsigned j = 0; j < NbCols; ++j)
+			{
+				const CPosition Pos (i, j);
+				if (Line [j] == Shown [j] &&
+					!(Moved && (Pos == Cursor || Pos == OldCursor)))
+				{
+					Placed = false;
+					continue;
+				}
+				if (!Placed)
+					MoveCursor (m_Frame, m_Top + i,
+								KLeftMargin + 1 + j * KCellWidth);
+				Placed = true;
+				m_Frame.SetColor (CandyColor (Line [j]), Pos == Cursor);
+				m_Frame.AppendNumber (Line [j], KCellWidth);
+				m_Shown.Set (i, j, Line [j]);
+			}
+		}
+		m_Frame.SetColor (KReset);
+
+		// Sous la grille, effacer les questions du tour précédent
+		MoveCursor (m_Frame, m_Top + Grid.GetNbRows (), 1);
+		m_Frame.Append ("\033[J");
+		m_Frame.Append (Footer);
+		return m_Frame.Flush ();
+	} // Update
+
+} // namespace nsNumberCrush
@@ -0,0 +1,165 @@
+/**
+*
+* @file Render.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Affichage de la grille image par image sur le terminal
+*
+*/
+
+#ifndef __RENDER_H__
+#define __RENDER_H__
+
+#include <cstddef>
+#include <string>
+
+#include "Grid.h"
+
+namespace nsNumberCrush
+{
+/**
+ * \class CFrame
+ * \brief Screen image built in memory then sent to the terminal with a
+ *  single write
+ *
+ * Colors are given as SGR codes (31 for red ...) ; a code is only
+ *  written when it differs from the current one.
+ *
+ */
+	class CFrame
+	{
+		std::string m_Buffer;
+		int         m_Color;    ///< Current color, -1 when unknown
+		bool        m_Reverse;  ///< Current color in reverse video
+
+	  public :
+		explicit CFrame (std::size_t Capacity = 16384);
+
+/**
+ * \fn void Clear ()
+ * \brief Empty the image, keeping its memory
+ *
+ */
+		void Clear ();
+
+/**
+ * \fn void ClearScreen ()
+ * \brief Cursor to the top left corner, then erase the screen
+ *
+ */
+		void ClearScreen ();
+
+/**
+ * \fn void SetColor (int Color, bool Reverse = false)
+ * \brief Reset the attributes then apply Color, unless already current
+ * \param Reverse Swap the text and the background colors
+ *
+ */
+		void SetColor (int Color, bool Reverse = false);
+
+		void Append (const std::string & Text) { m_Buffer += Text; }
+		void Append (char C)                   { m_Buffer += C; }
+
+/**
+ * \fn void AppendNumber (unsigned Value, unsigned Width = 0)
+ * \brief Value right-aligned on Width characters, like setw (Width)
+ *
+ */
+		void AppendNumber (unsigned Value, unsigned Width = 0);
+
+		const std::string & GetText () const { return m_Buffer; }
+
+/**
+ * \fn bool Flush ()
+ * \brief Send the image to the standard output, after what cout still
+ *  holds, then empty it
+ * \return false if the terminal refused the write
+ *
+ */
+		bool Flush ();
+
+	}; // CFrame
+
+/**
+ * \fn int CandyColor (CCell Cell)
+ * \brief Color of a cell : reset for 1, 30 to 36 for 2 to 8, red
+ *  background for an empty cell
+ *
+ */
+	int CandyColor (CCell Cell);
+
+/**
+ * \var KNoCursor
+ * \brief Cursor position meaning that no cell is selected
+ *
+ */
+	const CPosition KNoCursor (~0u, ~0u);
+
+/**
+ * \fn void DrawGrid (CFrame & Frame, const CGrid & Grid,
+ *  const CPosition & Cursor = KNoCursor)
+ * \brief Column numbers, then every line with its number and colored
+ *  cells, the one under Cursor in reverse video
+ *
+ */
+	void DrawGrid (CFrame & Frame, const CGrid & Grid,
+				   const CPosition & Cursor = KNoCursor);
+
+/**
+ * \class CScreen
+ * \brief Remembers the grid on the screen, so that the next one only
+ *  rewrites the cells that changed
+ *
+ * The screen holds a header (the logo), the grid drawn by DrawGrid, then
+ *  NbFooter lines of free text (prompts) that every update erases. The
+ *  whole screen is redrawn when it may have scrolled : unknown terminal
+ *  height, or not enough lines for the footer.
+ *
+ */
+	class CScreen
+	{
+		CFrame      m_Frame;
+		CGrid       m_Shown;   ///< Grid as it is on the screen
+		CPosition   m_Cursor;  ///< Cell in reverse video on the screen
+		std::string m_Header;
+		unsigned    m_Top;     ///< Screen line of the first grid line
+		bool        m_Valid;
+
+		void Redraw (const std::string & Header, const CGrid & Grid,
+					 const CPosition & Cursor);
+
+	  public :
+		CScreen () : m_Cursor (KNoCursor), m_Top (1), m_Valid (false) {}
+
+/**
+ * \fn void Invalidate ()
+ * \brief The screen was changed by someone else : redraw it next time
+ *
+ */
+		void Invalidate () { m_Valid = false; }
+
+/**
+ * \fn bool Update (const std::string & Header, const CGrid & Grid,
+ *  unsigned NbFooter, const std::string & Footer = std::string (),
+ *  const CPosition & Cursor = KNoCursor)
+ * \brief Show Header then Grid, and leave the cursor under the grid
+ * \param Header Text above the grid, ending with a new line
+ * \param NbFooter Lines written under the grid until the next update
+ * \param Footer Text written under the grid, in the same write
+ * \param Cursor Cell to show in reverse video
+ * \return false if the terminal refused the write
+ *
+ */
+		bool Update (const std::string & Header, const CGrid & Grid,
+					 unsigned NbFooter,
+					 const std::string & Footer = std::string (),
+					 const CPosition & Cursor = KNoCursor);
+
+	}; // CScreen
+
+} // namespace nsNumberCrush
+
+#endif /* __RENDER_H__ */
@@ -0,0 +1,224 @@
+/**
+*
+* @file Replay.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Enregistrement d'une partie (graine, déplacements, instants) et
+*        rejeu à l'identique
+*
+*/
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Replay.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		const char KMagic [8] = { 'N', 'C', 'R', 'E', 'P', 'L', 'Y', '1' };
+
+		const unsigned KMaxNames = 1000; // Stem-2 ... Stem-KMaxNames
+
+/**
+ * \struct CHeader
+ * \brief Start of a replay file, followed by NbMoves moves
+ *
+ */
+		struct CHeader
+		{
+			char     Magic [8];
+			uint64_t Seed;
+			uint8_t  Mode;
+			uint8_t  Level;
+			uint16_t NbMove;
+			uint32_t Ecart;
+			uint32_t Score;
+			uint32_t NbMoves;
+		}; // CHeader
+
+		// 7 bits par octet, le bit de poids fort annonce la suite
+		void PutVarint (string & Data, uint32_t Value)
+		{
+			for (; Value >= 0x80; Value >>= 7)
+				Data += char (Value | 0x80);
+			Data += char (Value);
+		} // PutVarint
+
+		bool GetVarint (const string & Data, size_t & Pos, uint32_t & Value)
+		{
+			Value = 0;
+			for (unsigned Shift = 0; Shift < 32 && Pos < Data.size ();
+				 Shift += 7)
+			{
+				const uint8_t Byte = Data [Pos++];
+				Value |= uint32_t (Byte & 0x7F) << Shift;
+				if (0 == (Byte & 0x80)) return true;
+			}
+			return false;
+		} // GetVarint
+
+	} // namespace
+
+	void CRecorder::Start (uint64_t Seed, unsigned Mode, unsigned Level,
+						   unsigned NbMove)
+	{
+		m_Replay.Seed   = Seed;
+		m_Replay.Mode   = Mode;
+		m_Replay.Level  = Level;
+		m_Replay.NbMove = NbMove;
+		m_Replay.Ecart = m_Replay.Score = 0;
+		m_Replay.Moves.clear ();
+		m_Start = CClock::now ();
+	} // Start
+
+	void CRecorder::Record (const CPosition & Pos, char Direction)
+	{
+		CReplayMove Move;
+		Move.Pos       = Pos;
+		Move.Direction = Direction;
+		Move.Time      = chrono::duration_cast <chrono::milliseconds> (
+			CClock::now () - m_Start).count ();
+		m_Replay.Moves.push_back (Move);
+	} // Record
+
+	void CRecorder::Finish (unsigned Ecart, unsigned Score)
+	{
+		m_Replay.Ecart = Ecart;
+		m_Replay.Score = Score;
+	} // Finish
+
+	bool SaveReplay (const string & Stem, const CReplay & Replay,
+					 string & Path)
+	{
+		// Sur 16 bits dans l'en-tête : tronqué, il changerait la partie
+		if (Replay.NbMove > KMaxMoveLimit) return false;
+
+		CHeader Header;
+		memset (&Header, 0, sizeof (Header));
+		memcpy (Header.Magic, KMagic, sizeof (KMagic));
+		Header.Seed    = Replay.Seed;
+		Header.Mode    = Replay.Mode;
+		Header.Level   = Replay.Level;
+		Header.NbMove  = Replay.NbMove;
+		Header.Ecart   = Replay.Ecart;
+		Header.Score   = Replay.Score;
+		Header.NbMoves = Replay.Moves.size ();
+
+		string Data ((const char *) &Header, sizeof (Header));
+		uint32_t Previous = 0;
+		for (unsigned i = 0; i < Replay.Moves.size (); ++i)
+		{
+			const CReplayMove & Move = Replay.Moves [i];
+			PutVarint (Data, Move.Pos.first);
+			PutVarint (Data, Move.Pos.second);
+			Data += Move.Direction;
+			// Les instants croissent : seul l'écart avec le précédent
+			PutVarint (Data, Move.Time - Previous);
+			Previous = Move.Time;
+		}
+
+		// O_EXCL : le premier nom libre, même si un autre processus
+		//  enregistre au même instant
+		int Fd = -1;
+		for (unsigned i = 1; Fd < 0 && i <= KMaxNames; ++i)
+		{
+			Path = Stem + (i > 1 ? "-" + to_string (i) : string ()) + ".ncr";
+			Fd = open (Path.c_str (), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+					   0644);
+			if (Fd < 0 && errno != EEXIST) return false;
+		}
+		if (Fd < 0) return false;
+
+		const char * Left = Data.data ();
+		for (size_t Size = Data.size (); Size != 0; )
+		{
+			const ssize_t NbWritten = write (Fd, Left, Size);
+			if (NbWritten < 0 && EINTR == errno) continue;
+			if (NbWritten < 0)
+			{
+				close (Fd);
+				unlink (Path.c_str ());
+				return false;
+			}
+			Left += NbWritten;
+			Size -= NbWritten;
+		}
+		return 0 == close (Fd);
+	} // SaveReplay
+
+	bool LoadReplay (const string & Path, CReplay & Replay)
+	{
+		ifstream Ifs (Path.c_str (), ios::binary);
+		const string Data ((istreambuf_iterator <char> (Ifs)),
+						   istreambuf_iterator <char> ());
+		CHeader Header;
+		if (Data.size () < sizeof (Header)) return false;
+		memcpy (&Header, Data.data (), sizeof (Header));
+		if (memcmp (Header.Magic, KMagic, sizeof (KMagic))) return false;
+
+		Replay.Seed   = Header.Seed;
+		Replay.Mode   = Header.Mode;
+		Replay.Level  = Header.Level;
+		Replay.NbMove = Header.NbMove;
+		Replay.Ecart  = Header.Ecart;
+		Replay.Score  = Header.Score;
+		Replay.Moves.clear ();
+
+		size_t   Pos  = sizeof (Header);
+		uint32_t Time = 0;
+		for (unsigned i = 0; i < Header.NbMoves; ++i)
+		{
+			CReplayMove Move;
+			uint32_t Row, Col, Delta;
+			if (!GetVarint (Data, Pos, Row) || !GetVarint (Data, Pos, Col) ||
+				Pos >= Data.size ())
+				return false;
+			Move.Direction = Data [Pos++];
+			if (!GetVarint (Data, Pos, Delta)) return false;
+			Move.Pos  = CPosition (Row, Col);
+			Move.Time = Time += Delta;
+			Replay.Moves.push_back (Move);
+		}
+		return true;
+	} // LoadReplay
+
+	void StartReplay (CGame & Game, const CReplay & Replay)
+	{
+		static const char * const KDifficulties [KNbLevels] =
+		{
+			"Easy", "Medium", "Hard"
+		};
+		CDifficulty Params;
+		GetDifficulty (KDifficulties [Replay.Level < KNbLevels
+									  ? Replay.Level : KNbLevels - 1],
+					   Params);
+		if (Replay.NbMove) Params.NbMove = Replay.NbMove;
+		InitGame (Game, Params, Replay.Seed);
+		Resolve (Game);
+	} // StartReplay
+
+	bool ReplayMove (CGame & Game, const CReplayMove & Move)
+	{
+		if (KGiveUp == Move.Direction)
+		{
+			Game.Score = 0;
+			return true;
+		}
+		if (!ApplyMove (Game, Move.Pos, Move.Direction)) return false;
+		Resolve (Game);
+		return true;
+	} // ReplayMove
+
+} // namespace nsNumberCrush
@@ -0,0 +1,146 @@
+/**
+*
+* @file Replay.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Enregistrement d'une partie (graine, déplacements, instants) et
+*        rejeu à l'identique
+*
+* Le moteur est déterministe : la graine redonne la grille, et chaque
+*  déplacement rejoué redonne les mêmes cascades et le même score.
+*
+*/
+
+#ifndef __REPLAY_H__
+#define __REPLAY_H__
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Engine.h"
+
+namespace nsNumberCrush
+{
+	const char     KGiveUp       = 'Q';   ///< Move ending the game
+	const unsigned KMaxMoveLimit = 65535; ///< Largest CReplay::NbMove
+
+/**
+ * \struct CReplayMove
+ * \brief One swap of the player, or KGiveUp
+ *
+ */
+	struct CReplayMove
+	{
+		CPosition     Pos;
+		char          Direction; ///< 'A', 'Z', 'E', 'S' or KGiveUp
+		std::uint32_t Time;      ///< Milliseconds since the game started
+	}; // CReplayMove
+
+/**
+ * \struct CReplay
+ * \brief Everything needed to play a game again
+ *
+ */
+	struct CReplay
+	{
+		std::uint64_t Seed;
+		unsigned      Mode;   ///< CGameMode::GetId
+		unsigned      Level;  ///< GetLevel
+		unsigned      NbMove; ///< Moves allowed, 0 for those of Level
+		unsigned      Ecart;  ///< Seconds the final score was computed with
+		unsigned      Score;  ///< Final score shown to the player
+		std::vector <CReplayMove> Moves;
+	}; // CReplay
+
+/**
+ * \class CRecorder
+ * \brief Builds the replay of the game in progress
+ *
+ */
+	class CRecorder
+	{
+		typedef std::chrono::steady_clock CClock;
+
+		CReplay            m_Replay;
+		CClock::time_point m_Start;
+
+	  public :
+/**
+ * \fn void Start (std::uint64_t Seed, unsigned Mode, unsigned Level,
+ *  unsigned NbMove)
+ * \brief Forget the previous game ; times are counted from now
+ * \param NbMove Moves allowed, which may differ from those of Level
+ *
+ */
+		void Start (std::uint64_t Seed, unsigned Mode, unsigned Level,
+					unsigned NbMove);
+
+/**
+ * \fn void Record (const CPosition & Pos, char Direction)
+ * \brief Add a move the game has accepted, or KGiveUp
+ *
+ */
+		void Record (const CPosition & Pos, char Direction);
+
+/**
+ * \fn void Finish (unsigned Ecart, unsigned Score)
+ * \brief Keep the final score and the duration it was computed with
+ *
+ */
+		void Finish (unsigned Ecart, unsigned Score);
+
+		const CReplay & GetReplay () const { return m_Replay; }
+
+	}; // CRecorder
+
+/**
+ * \fn bool SaveReplay (const std::string & Stem, const CReplay & Replay,
+ *  std::string & Path)
+ * \brief Write Replay in a new small binary file
+ *
+ * After a 32 bytes header, each move takes its row, its column and the
+ *  milliseconds since the previous move, as variable length integers, and
+ *  its direction : usually 5 bytes.
+ *
+ * The file is Stem.ncr, or Stem-2.ncr, Stem-3.ncr ... if it exists : a
+ *  game saved at the same time by another process is never overwritten.
+ *
+ * \param Path Set to the name of the file written
+ * \return false if no file could be created or written, or if
+ *  Replay.NbMove is above KMaxMoveLimit
+ *
+ */
+	bool SaveReplay (const std::string & Stem, const CReplay & Replay,
+					 std::string & Path);
+
+/**
+ * \fn bool LoadReplay (const std::string & Path, CReplay & Replay)
+ * \brief Read a file written by SaveReplay
+ * \return false if it cannot be read or is not a replay
+ *
+ */
+	bool LoadReplay (const std::string & Path, CReplay & Replay);
+
+/**
+ * \fn void StartReplay (CGame & Game, const CReplay & Replay)
+ * \brief Start Game as the recorded one started, first cascades included
+ *
+ */
+	void StartReplay (CGame & Game, const CReplay & Replay);
+
+/**
+ * \fn bool ReplayMove (CGame & Game, const CReplayMove & Move)
+ * \brief Play Move and its cascades, as the game did
+ * \return false if Move is not valid on this grid
+ *
+ */
+	bool ReplayMove (CGame & Game, const CReplayMove & Move);
+
+} // namespace nsNumberCrush
+
+#endif /* __REPLAY_H__ */
@@ -0,0 +1,153 @@
+/**
+*
+* @file ReplayRoundTrip.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Une partie entière jouée par les questions de NumberCrush,
+*        enregistrée, puis rejouée : le rejeu doit retrouver le score
+*
+* replay-roundtrip Path/To/NumberCrush
+*
+* Les coups sont choisis ici par le moteur, sur la grille que le jeu
+*  tire de la même graine (--seed), jusqu'à la limite de coups (--moves) :
+*  le dernier coup et sa cascade comptent, au jeu comme au rejeu.
+*
+*/
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include "Engine.h"
+#include "Policy.h"
+#include "Replay.h"
+
+using namespace std;
+using namespace nsNumberCrush;
+
+namespace
+{
+	const unsigned KMaxSeeds = 100; // graines essayées au plus
+	const unsigned KNbMoves  = 10;  // coups permis à la partie jouée
+
+/**
+ * \fn bool MakeInput (std::uint64_t Seed, std::string & Input,
+ *  unsigned & NbMoves)
+ * \brief Answers to the menu and to the prompts that play a whole
+ *  standard game of the default difficulty in KNbMoves moves, the greedy
+ *  move each time
+ * \return false if the grid runs out of moves before the move limit
+ *
+ */
+	bool MakeInput (uint64_t Seed, string & Input, unsigned & NbMoves)
+	{
+		CDifficulty Params;
+		GetDifficulty ("Easy", Params);
+		Params.NbMove = KNbMoves;
+		CGame Game;
+		InitGame (Game, Params, Seed);
+		Resolve (Game);
+
+		CLookaheadPolicy Greedy (1);
+		ostringstream Text;
+		Text << "S\n";
+		CMove Move;
+		for (NbMoves = 0; Game.NbMove > 0; ++NbMoves)
+		{
+			if (!Greedy.Choose (Game, Move)) return false;
+			Text << Move.Pos.first + 1 << ' ' << Move.Pos.second + 1 << ' '
+				 << Move.Direction << '\n';
+			ApplyMove (Game, Move.Pos, Move.Direction);
+			Resolve (Game);
+		}
+		// Pseudo du tableau des scores, puis sortie du menu
+		Text << "roundtrip\nQ\n";
+		Input = Text.str ();
+		return true;
+	} // MakeInput
+
+	// Les parties enregistrées dans Dir
+	vector <string> FindReplays (const string & Dir)
+	{
+		vector <string> Paths;
+		DIR * Entries = opendir (Dir.c_str ());
+		if (!Entries) return Paths;
+		for (dirent * Entry; (Entry = readdir (Entries)) != 0;)
+		{
+			const string Name = Entry->d_name;
+			if (Name.size () > 4 && Name.compare (Name.size () - 4, 4,
+												   ".ncr") == 0)
+				Paths.push_back (Dir + "/" + Name);
+		}
+		closedir (Entries);
+		return Paths;
+	} // FindReplays
+
+} // namespace
+
+int main (int argc, char * argv [])
+{
+	if (argc != 2)
+	{
+		cerr << "Usage : " << argv [0] << " Path/To/NumberCrush" << endl;
+		return 2;
+	}
+	const string Game = argv [1];
+
+	string   Input;
+	unsigned NbMoves = 0;
+	uint64_t Seed = 1;
+	for (; Seed <= KMaxSeeds && !MakeInput (Seed, Input, NbMoves); ++Seed);
+	if (Seed > KMaxSeeds)
+	{
+		cerr << "No seed plays up to the move limit" << endl;
+		return 1;
+	}
+
+	// Les scores et la partie vont dans un dossier à part
+	char Dir [] = "/tmp/numbercrush-roundtrip-XXXXXX";
+	if (!mkdtemp (Dir) || chdir (Dir) != 0)
+	{
+		cerr << "Cannot create a work directory" << endl;
+		return 1;
+	}
+
+	const string Command = "'" + Game + "' --seed " + to_string (Seed) +
+						   " --moves " + to_string (KNbMoves) +
+						   " --record . > game.out";
+	FILE * Pipe = popen (Command.c_str (), "w");
+	if (!Pipe || fwrite (Input.data (), 1, Input.size (), Pipe) !=
+				 Input.size () || pclose (Pipe) != 0)
+	{
+		cerr << "The game failed : " << Dir << "/game.out" << endl;
+		return 1;
+	}
+
+	const vector <string> Paths = FindReplays (".");
+	CReplay Replay;
+	if (Paths.size () != 1 || !LoadReplay (Paths [0], Replay))
+	{
+		cerr << "Expected one replay in " << Dir << endl;
+		return 1;
+	}
+	if (Replay.Moves.size () != NbMoves)
+	{
+		cerr << "Seed " << Seed << " : " << Replay.Moves.size ()
+			 << " moves recorded, " << NbMoves << " played" << endl;
+		return 1;
+	}
+	if (system (("'" + Game + "' --replay " + Paths [0]).c_str ()) != 0)
+		return 1;
+
+	// Le dossier n'est gardé que pour comprendre un échec
+	system (("rm -rf '" + string (Dir) + "'").c_str ());
+	return 0;
+} // main
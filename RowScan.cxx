@@ -0,0 +1,205 @@
+/**
+*
+* @file RowScan.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Débuts des suites de trois d'une ligne, 16 ou 32 cases à la fois
+*
+*/
+
+#include <algorithm>
+
+#if defined (__x86_64__) || defined (__i386__)
+#define NUMBERCRUSH_X86
+#include <immintrin.h>
+#endif
+
+#include "RowScan.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		typedef void (*CRowStarts) (const CCell *, unsigned, CWord *);
+
+		void ClearStarts (unsigned NbCols, CWord * Starts)
+		{
+			fill (Starts, Starts + (NbCols + KBitsPerWord - 1) / KBitsPerWord,
+				  CWord (0));
+		} // ClearStarts
+
+		// Une case à la fois
+		void ScalarStarts (const CCell * Line, unsigned NbCols, CWord * Starts)
+		{
+			ClearStarts (NbCols, Starts);
+			for (unsigned j = 0; j + 2 < NbCols; ++j)
+				if (Line [j] != 0 && Line [j] == Line [j + 1] &&
+					Line [j] == Line [j + 2])
+					Starts [j / KBitsPerWord] |=
+						CWord (1) << (j % KBitsPerWord);
+		} // ScalarStarts
+
+#ifdef NUMBERCRUSH_X86
+		// Plus court qu'un bloc de 16 et ses deux voisines, la recopie
+		//  de la fin coûte plus qu'elle ne rapporte
+		const unsigned KMinBlockCols = 18;
+
+/**
+ * \fn unsigned Sse2Mask (const CCell * Cells)
+ * \brief Bit k set when Cells [k] starts three identical numbers, for
+ *  the 16 first cells ; reads 18 cells
+ *
+ */
+		__attribute__ ((target ("sse2")))
+		inline unsigned Sse2Mask (const CCell * Cells)
+		{
+			const __m128i A = _mm_loadu_si128 ((const __m128i *) Cells);
+			const __m128i B = _mm_loadu_si128 ((const __m128i *) (Cells + 1));
+			const __m128i C = _mm_loadu_si128 ((const __m128i *) (Cells + 2));
+			const __m128i Same = _mm_and_si128 (_mm_cmpeq_epi8 (A, B),
+												_mm_cmpeq_epi8 (A, C));
+			const __m128i Empty = _mm_cmpeq_epi8 (A, _mm_setzero_si128 ());
+			return _mm_movemask_epi8 (_mm_andnot_si128 (Empty, Same));
+		} // Sse2Mask
+
+/**
+ * \fn void Sse2Tail (const CCell * Line, unsigned NbCols, unsigned First,
+ *  CWord * Starts)
+ * \brief From the cell First, a multiple of 16, to the end of the line
+ *
+ * The last cells are copied before zeros : the blocks can then read past
+ *  the end of the line, and an empty cell never starts nor continues an
+ *  alignment, so the bits beyond NbCols - 3 stay at 0.
+ *
+ */
+		__attribute__ ((target ("sse2")))
+		void Sse2Tail (const CCell * Line, unsigned NbCols, unsigned First,
+					   CWord * Starts)
+		{
+			CCell Tail [64] = { 0 };
+			const unsigned NbLeft = NbCols - First;
+			copy (Line + First, Line + NbCols, Tail);
+			for (unsigned k = 0; k + 2 < NbLeft; k += 16)
+			{
+				const unsigned j = First + k;
+				Starts [j / KBitsPerWord] |=
+					CWord (Sse2Mask (Tail + k)) << (j % KBitsPerWord);
+			}
+		} // Sse2Tail
+
+		__attribute__ ((target ("sse2")))
+		void Sse2Starts (const CCell * Line, unsigned NbCols, CWord * Starts)
+		{
+			if (NbCols < KMinBlockCols)
+				return ScalarStarts (Line, NbCols, Starts);
+			ClearStarts (NbCols, Starts);
+			unsigned j = 0;
+			for (; j + 18 <= NbCols; j += 16)
+				Starts [j / KBitsPerWord] |=
+					CWord (Sse2Mask (Line + j)) << (j % KBitsPerWord);
+			Sse2Tail (Line, NbCols, j, Starts);
+		} // Sse2Starts
+
+		__attribute__ ((target ("avx2")))
+		void Avx2Starts (const CCell * Line, unsigned NbCols, CWord * Starts)
+		{
+			if (NbCols < KMinBlockCols)
+				return ScalarStarts (Line, NbCols, Starts);
+			ClearStarts (NbCols, Starts);
+			const __m256i Zero = _mm256_setzero_si256 ();
+			unsigned j = 0;
+			for (; j + 34 <= NbCols; j += 32)
+			{
+				const __m256i A = _mm256_loadu_si256 ((const __m256i *)
+													  (Line + j));
+				const __m256i B = _mm256_loadu_si256 ((const __m256i *)
+													  (Line + j + 1));
+				const __m256i C = _mm256_loadu_si256 ((const __m256i *)
+													  (Line + j + 2));
+				const __m256i Same = _mm256_and_si256 (
+					_mm256_cmpeq_epi8 (A, B), _mm256_cmpeq_epi8 (A, C));
+				const __m256i Run = _mm256_andnot_si256 (
+					_mm256_cmpeq_epi8 (A, Zero), Same);
+				Starts [j / KBitsPerWord] |=
+					CWord (unsigned (_mm256_movemask_epi8 (Run)))
+						<< (j % KBitsPerWord);
+			}
+			// Moins de 34 cases : deux blocs de 16 au plus
+			Sse2Tail (Line, NbCols, j, Starts);
+		} // Avx2Starts
+#endif
+
+		const CRowStarts KRowStarts [KNbRowScans] =
+		{
+			ScalarStarts,
+#ifdef NUMBERCRUSH_X86
+			Sse2Starts,
+			Avx2Starts
+#else
+			0,
+			0
+#endif
+		};
+
+		CRowScan ChooseRowScan ()
+		{
+#ifdef NUMBERCRUSH_X86
+			// Appelée avant les constructeurs de libgcc
+			__builtin_cpu_init ();
+#endif
+			for (int Scan = KNbRowScans - 1; Scan > KRowScanScalar; --Scan)
+				if (IsRowScanSupported (CRowScan (Scan)))
+					return CRowScan (Scan);
+			return KRowScanScalar;
+		} // ChooseRowScan
+
+		// Choisie une fois pour toutes, au chargement du programme
+		const CRowScan   KChosen       = ChooseRowScan ();
+		const CRowStarts KChosenStarts = KRowStarts [KChosen];
+
+	} // namespace
+
+	void RowStarts (const CCell * Line, unsigned NbCols, CWord * Starts)
+	{
+		KChosenStarts (Line, NbCols, Starts);
+	} // RowStarts
+
+	void RowStarts (CRowScan Scan, const CCell * Line, unsigned NbCols,
+					CWord * Starts)
+	{
+		KRowStarts [Scan] (Line, NbCols, Starts);
+	} // RowStarts
+
+	bool IsRowScanSupported (CRowScan Scan)
+	{
+		switch (Scan)
+		{
+		  case KRowScanScalar : return true;
+#ifdef NUMBERCRUSH_X86
+		  case KRowScanSse2   : return __builtin_cpu_supports ("sse2");
+		  case KRowScanAvx2   : return __builtin_cpu_supports ("avx2");
+#endif
+		  default             : return false;
+		}
+	} // IsRowScanSupported
+
+	CRowScan GetRowScan ()
+	{
+		return KChosen;
+	} // GetRowScan
+
+	const char * GetRowScanName (CRowScan Scan)
+	{
+		static const char * const KNames [KNbRowScans] =
+		{
+			"scalar", "sse2", "avx2"
+		};
+		return KNames [Scan];
+	} // GetRowScanName
+
+} // namespace nsNumberCrush
@@ -0,0 +1,80 @@
+/**
+*
+* @file RowScan.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Débuts des suites de trois d'une ligne, 16 ou 32 cases à la fois
+*        (SSE2, AVX2) ; la version est choisie au lancement selon le
+*        processeur
+*
+*/
+
+#ifndef __ROWSCAN_H__
+#define __ROWSCAN_H__
+
+#include "Grid.h"
+
+namespace nsNumberCrush
+{
+/**
+ * \enum CRowScan
+ * \brief Versions of RowStarts, from the slowest to the fastest
+ *
+ */
+	enum CRowScan
+	{
+		KRowScanScalar, ///< One cell at a time, on every processor
+		KRowScanSse2,   ///< 16 cells at a time
+		KRowScanAvx2,   ///< 32 cells at a time
+		KNbRowScans
+	}; // CRowScan
+
+/**
+ * \fn void RowStarts (const CCell * Line, unsigned NbCols, CWord * Starts)
+ * \brief Find where three identical numbers start in a line
+ * \param Line The NbCols cells of the line
+ * \param Starts Its (NbCols + 63) / 64 words are overwritten : bit j is
+ *  set when Line [j] is not empty and equals Line [j + 1] and Line [j + 2]
+ *
+ * Compares the line with itself shifted by one and by two cells, with
+ *  the fastest version the processor supports.
+ *
+ */
+	void RowStarts (const CCell * Line, unsigned NbCols, CWord * Starts);
+
+/**
+ * \fn void RowStarts (CRowScan Scan, const CCell * Line, unsigned NbCols,
+ *  CWord * Starts)
+ * \brief Same as RowStarts, with a given version which must be supported
+ *
+ */
+	void RowStarts (CRowScan Scan, const CCell * Line, unsigned NbCols,
+					CWord * Starts);
+
+/**
+ * \fn bool IsRowScanSupported (CRowScan Scan)
+ * \brief true if the processor (and the compiler) can run Scan
+ *
+ */
+	bool IsRowScanSupported (CRowScan Scan);
+
+/**
+ * \fn CRowScan GetRowScan ()
+ * \brief Version used by RowStarts : the fastest supported one
+ *
+ */
+	CRowScan GetRowScan ();
+
+/**
+ * \fn const char * GetRowScanName (CRowScan Scan)
+ * \brief "scalar", "sse2" or "avx2"
+ *
+ */
+	const char * GetRowScanName (CRowScan Scan);
+
+} // namespace nsNumberCrush
+
+#endif /* __ROWSCAN_H__ */
@@ -0,0 +1,89 @@
+/**
+*
+* @file RowScanCheck.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Chaque version de RowStarts (SSE2, AVX2) que la machine connaît
+*        est comparée à la version scalaire sur des lignes tirées au hasard
+*
+* rowscan-check
+*
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "Engine.h"
+#include "RowScan.h"
+
+using namespace std;
+using namespace nsNumberCrush;
+
+namespace
+{
+	const unsigned KMaxCols = 1100; // plus de trois blocs de 32 cases
+	const unsigned KNbDraws = 8;    // lignes tirées par longueur
+
+/**
+ * \fn bool CheckRowScan (CRowScan Scan)
+ * \brief Compare Scan with the scalar RowStarts, on random lines of 1 to
+ *  KMaxCols cells with few numbers and some empty cells, so that runs are
+ *  frequent and cross the 32 cell blocks
+ * \return false, after telling where, at the first difference
+ *
+ */
+	bool CheckRowScan (CRowScan Scan)
+	{
+		CRandom Rng (42);
+		vector <CCell> Line;
+		vector <CWord> Expected, Starts;
+		for (unsigned NbCols = 1; NbCols <= KMaxCols; ++NbCols)
+			for (unsigned Draw = 0; Draw < KNbDraws; ++Draw)
+			{
+				// 1 à 3 nombres plus la case vide
+				const unsigned NbValues = 2 + Draw % 3;
+				Line.resize (NbCols);
+				for (unsigned j = 0; j < NbCols; ++j)
+					Line [j] = Rng.Below (NbValues);
+				const unsigned NbWords = (NbCols + KBitsPerWord - 1) /
+										 KBitsPerWord;
+				Expected.assign (NbWords, ~CWord (0));
+				RowStarts (KRowScanScalar, &Line [0], NbCols, &Expected [0]);
+
+				// Des bits à 1 partout : RowStarts doit tout réécrire
+				Starts.assign (NbWords, ~CWord (0));
+				RowStarts (Scan, &Line [0], NbCols, &Starts [0]);
+				if (Starts != Expected)
+				{
+					cerr << "RowStarts/" << GetRowScanName (Scan)
+						 << " differs from scalar on " << NbCols
+						 << " cells" << endl;
+					return false;
+				}
+			}
+		return true;
+	} // CheckRowScan
+
+} // namespace
+
+int main ()
+{
+	bool IsOk = true;
+	for (int Scan = KRowScanScalar + 1; Scan < KNbRowScans; ++Scan)
+	{
+		const char * Name = GetRowScanName (CRowScan (Scan));
+		if (!IsRowScanSupported (CRowScan (Scan)))
+		{
+			cout << Name << " : not supported here, skipped" << endl;
+			continue;
+		}
+		const bool IsSame = CheckRowScan (CRowScan (Scan));
+		cout << Name << " : " << (IsSame ? "same as scalar" : "DIFFERS")
+			 << endl;
+		IsOk = IsOk && IsSame;
+	}
+	return IsOk ? 0 : 1;
+} // main
@@ -0,0 +1,440 @@
+/**
+*
+* @file ScoreStore.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Meilleurs scores : journal binaire en ajout seul, plus un index
+*        des KTopScores premiers de chaque mode et difficulté
+*
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <random>
+
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Engine.h"
+#include "Mode.h"
+#include "ScoreStore.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		const char KLogMagic   [8] = { 'N', 'C', 'S', 'L', 'O', 'G', '0', '1' };
+		const char KIndexMagic [8] = { 'N', 'C', 'S', 'I', 'D', 'X', '0', '1' };
+		const unsigned KNbTables   = KNbModes * KNbLevels;
+
+		// Le journal est mis sur disque tous les KSyncEvery scores, ou au
+		//  premier score qui suit de KSyncDelay secondes le plus ancien
+		//  score pas encore sur disque. Rien ne tourne entre deux Add : si
+		//  aucun score ne suit, les derniers attendent que le système les
+		//  écrive de lui-même
+		const unsigned KSyncEvery = 16;
+		const int64_t  KSyncDelay = 5;
+
+		// Lus d'un bloc quand l'index est reconstruit
+		const unsigned KNbReadRecords = 256;
+
+		// Un lecteur qui trouve l'index en cours d'écriture tant de fois
+		//  de suite abandonne : l'écrivain s'est sans doute arrêté
+		const unsigned KNbReadTries = 1000;
+
+/**
+ * \struct CLogHeader
+ * \brief Start of the log, before the records
+ *
+ */
+		struct CLogHeader
+		{
+			char     Magic [8];
+			uint64_t Id;       ///< Drawn when the log is created
+		}; // CLogHeader
+
+	} // namespace
+
+/**
+ * \struct CTopTable
+ * \brief The best records of one mode and level
+ *
+ */
+	struct CTopTable
+	{
+		uint32_t     NbScores;
+		uint32_t     Reserved;
+		CScoreRecord Scores [KTopScores];
+	}; // CTopTable
+
+/**
+ * \struct CScoreIndex
+ * \brief The whole index file, mapped in memory : LogSize bytes of the
+ *  log are accounted for, then one table per mode and level, mode after
+ *  mode
+ *
+ * Sequence is a sequence lock : a writer makes it odd, changes the rest,
+ *  then makes it even again. A reader copies what it needs between two
+ *  reads of Sequence, and starts again if it was odd or has changed.
+ *
+ */
+	struct CScoreIndex
+	{
+		uint32_t  Sequence;
+		uint32_t  NbUnsynced;    ///< Records not known to be on disk
+		char      Magic [8];
+		uint64_t  LogSize;
+		int64_t   FirstUnsynced; ///< When the first of them was added
+		uint64_t  LogId;         ///< CLogHeader::Id of the log indexed
+		CTopTable Tables [KNbTables];
+	}; // CScoreIndex
+
+	namespace
+	{
+		const uint64_t KLogHeaderSize = sizeof (CLogHeader);
+
+		inline unsigned TableOf (unsigned Mode, unsigned Level)
+		{
+			return Mode * KNbLevels + Level;
+		} // TableOf
+
+		// Sequence exceptée, que les lecteurs peuvent être en train de lire
+		const size_t KIndexBody = offsetof (CScoreIndex, NbUnsynced);
+
+		void ClearIndex (CScoreIndex & Index, uint64_t LogId)
+		{
+			memset ((char *) &Index + KIndexBody, 0,
+					sizeof (Index) - KIndexBody);
+			memcpy (Index.Magic, KIndexMagic, sizeof (KIndexMagic));
+			Index.LogSize = KLogHeaderSize;
+			Index.LogId   = LogId;
+		} // ClearIndex
+
+/**
+ * \fn bool IsValid (const CScoreIndex & Index, uint64_t Size,
+ *  uint64_t LogId)
+ * \brief false if the index is not finished, was built from another log
+ *  (a log removed then created again has another identifier) or is ahead
+ *  of it : it must then be rebuilt
+ *
+ */
+		bool IsValid (const CScoreIndex & Index, uint64_t Size,
+					  uint64_t LogId)
+		{
+			return 0 == (Index.Sequence & 1) &&
+				   0 == memcmp (Index.Magic, KIndexMagic,
+								sizeof (KIndexMagic)) &&
+				   Index.LogId == LogId &&
+				   Index.LogSize >= KLogHeaderSize && Index.LogSize <= Size &&
+				   0 == (Index.LogSize - KLogHeaderSize) %
+						sizeof (CScoreRecord);
+		} // IsValid
+
+		// Impaire : les lecteurs attendent ; reste impaire après un
+		//  écrivain arrêté en chemin
+		void BeginWrite (CScoreIndex & Index)
+		{
+			__atomic_store_n (&Index.Sequence, Index.Sequence | 1,
+							  __ATOMIC_RELAXED);
+			__atomic_thread_fence (__ATOMIC_RELEASE);
+		} // BeginWrite
+
+		void EndWrite (CScoreIndex & Index)
+		{
+			__atomic_store_n (&Index.Sequence, Index.Sequence + 1,
+							  __ATOMIC_RELEASE);
+		} // EndWrite
+
+/**
+ * \fn unsigned Insert (CTopTable & Table, const CScoreRecord & Record)
+ * \brief Place Record after the scores at least as high, dropping the
+ *  last one if the table is full
+ * \return Rank of Record from 1, 0 if it is not kept
+ *
+ */
+		unsigned Insert (CTopTable & Table, const CScoreRecord & Record)
+		{
+			unsigned Pos = 0;
+			while (Pos < Table.NbScores &&
+				   Table.Scores [Pos].Score >= Record.Score)
+				++Pos;
+			if (Pos >= KTopScores) return 0;
+
+			if (Table.NbScores < KTopScores) ++Table.NbScores;
+			for (unsigned i = Table.NbScores - 1; i > Pos; --i)
+				Table.Scores [i] = Table.Scores [i - 1];
+			Table.Scores [Pos] = Record;
+			return Pos + 1;
+		} // Insert
+
+		bool WriteAll (int Fd, const void * Data, size_t Size)
+		{
+			for (const char * Left = (const char *) Data; Size != 0; )
+			{
+				const ssize_t NbWritten = write (Fd, Left, Size);
+				if (NbWritten < 0)
+				{
+					if (EINTR == errno) continue;
+					return false;
+				}
+				Left += NbWritten;
+				Size -= NbWritten;
+			}
+			return true;
+		} // WriteAll
+
+/**
+ * \fn bool CatchUp (int Log, uint64_t Size, CScoreIndex & Index,
+ *  unsigned & Rank)
+ * \brief Insert the records of the log the index does not account for
+ * \param Size Size of the log, a whole number of records
+ * \param Rank Rank of the last one, as Insert
+ *
+ */
+		bool CatchUp (int Log, uint64_t Size, CScoreIndex & Index,
+					  unsigned & Rank)
+		{
+			CScoreRecord Records [KNbReadRecords];
+			Rank = 0;
+			while (Index.LogSize < Size)
+			{
+				const ssize_t NbRead = pread (Log, Records,
+					min <uint64_t> (Size - Index.LogSize, sizeof (Records)),
+					Index.LogSize);
+				if (NbRead < 0 && EINTR == errno) continue;
+				if (NbRead <= 0) return false;
+
+				const unsigned NbRecords = NbRead / sizeof (CScoreRecord);
+				for (unsigned i = 0; i < NbRecords; ++i)
+				{
+					const CScoreRecord & Record = Records [i];
+					Rank = Record.Mode < KNbModes && Record.Level < KNbLevels
+						 ? Insert (Index.Tables [TableOf (Record.Mode,
+														 Record.Level)],
+								   Record)
+						 : 0;
+				}
+				Index.LogSize += NbRecords * sizeof (CScoreRecord);
+			}
+			return true;
+		} // CatchUp
+
+/**
+ * \fn bool AppendRecord (int Log, const CScoreRecord & Record,
+ *  uint64_t & Size, uint64_t & LogId)
+ * \brief Append Record to the log, which must be locked
+ * \param Size Set to the size of the log, Record included
+ * \param LogId Set to the identifier of the log, drawn if it is new
+ *
+ * A record left unfinished by a process that stopped in the middle is
+ *  removed first, so that the records stay aligned.
+ *
+ */
+		bool AppendRecord (int Log, const CScoreRecord & Record,
+						   uint64_t & Size, uint64_t & LogId)
+		{
+			struct stat Stat;
+			if (fstat (Log, &Stat) != 0) return false;
+			Size = Stat.st_size;
+
+			const uint64_t NbOver = Size < KLogHeaderSize ? Size :
+				(Size - KLogHeaderSize) % sizeof (CScoreRecord);
+			if (NbOver != 0)
+			{
+				Size -= NbOver;
+				if (ftruncate (Log, Size) != 0) return false;
+			}
+			// Nouveau journal : son en-tête d'abord, avec un identifiant
+			//  propre, que l'index retient
+			CLogHeader Header;
+			if (0 == Size)
+			{
+				random_device Device;
+				memcpy (Header.Magic, KLogMagic, sizeof (KLogMagic));
+				Header.Id = uint64_t (Device ()) << 32 ^ Device () ^
+							uint64_t (time (NULL)) ^ uint64_t (getpid ()) << 40;
+				if (!WriteAll (Log, &Header, sizeof (Header))) return false;
+				Size = KLogHeaderSize;
+			}
+			else
+			{
+				ssize_t NbRead;
+				do
+					NbRead = pread (Log, &Header, sizeof (Header), 0);
+				while (NbRead < 0 && EINTR == errno);
+				if (NbRead != ssize_t (sizeof (Header))) return false;
+			}
+			LogId = Header.Id;
+			// O_APPEND : écrit en fin de fichier, d'un seul write
+			if (!WriteAll (Log, &Record, sizeof (Record))) return false;
+			Size += sizeof (Record);
+			return true;
+		} // AppendRecord
+
+		// Plusieurs scores par fdatasync ; KSyncDelay n'est tenu que si un
+		//  autre score est ajouté entre-temps
+		void SyncLog (int Log, CScoreIndex & Index)
+		{
+			const int64_t Now = time (NULL);
+			if (0 == Index.NbUnsynced++) Index.FirstUnsynced = Now;
+			if (Index.NbUnsynced < KSyncEvery &&
+				Now - Index.FirstUnsynced < KSyncDelay)
+				return;
+			if (0 == fdatasync (Log)) Index.NbUnsynced = 0;
+		} // SyncLog
+
+	} // namespace
+
+	void MakeScoreRecord (CScoreRecord & Record, const string & Pseudo,
+						  unsigned Score, unsigned Mode, unsigned Level,
+						  int64_t Time)
+	{
+		memset (&Record, 0, sizeof (Record));
+		Pseudo.copy (Record.Pseudo, KPseudoLength);
+		Record.Score = Score;
+		Record.Mode  = Mode;
+		Record.Level = Level;
+		Record.Time  = Time;
+	} // MakeScoreRecord
+
+	unsigned GetPseudoLength (const CScoreRecord & Record)
+	{
+		const void * End = memchr (Record.Pseudo, 0, KPseudoLength);
+		return End ? (const char *) End - Record.Pseudo : KPseudoLength;
+	} // GetPseudoLength
+
+	CScoreStore::CScoreStore (const string & Path)
+		: m_LogPath (Path + ".log"), m_Index (0)
+	{
+		const string IndexPath = Path + ".idx";
+		const int Fd = open (IndexPath.c_str (), O_RDWR | O_CREAT | O_CLOEXEC,
+							 0644);
+		if (Fd < 0) return;
+
+		// Taille fixe ; un index neuf, rempli de 0, est reconstruit au
+		//  premier Add
+		struct stat Stat;
+		if (0 == fstat (Fd, &Stat) &&
+			(uint64_t (Stat.st_size) == sizeof (CScoreIndex) ||
+			 0 == ftruncate (Fd, sizeof (CScoreIndex))))
+		{
+			void * Map = mmap (0, sizeof (CScoreIndex), PROT_READ | PROT_WRITE,
+							   MAP_SHARED, Fd, 0);
+			if (Map != MAP_FAILED) m_Index = (CScoreIndex *) Map;
+		}
+		close (Fd);
+	} // CScoreStore
+
+	CScoreStore::~CScoreStore ()
+	{
+		if (m_Index) munmap (m_Index, sizeof (CScoreIndex));
+	} // ~CScoreStore
+
+	bool CScoreStore::Add (const CScoreRecord & Record, unsigned * Rank)
+	{
+		if (!m_Index) return false;
+		const int Log = open (m_LogPath.c_str (),
+							  O_RDWR | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+		if (Log < 0) return false;
+
+		// Un seul écrivain à la fois, du journal jusqu'à l'index ; les
+		//  lecteurs ne prennent pas le verrou
+		while (flock (Log, LOCK_EX) != 0)
+			if (errno != EINTR)
+			{
+				close (Log);
+				return false;
+			}
+
+		CScoreIndex & Index = *m_Index;
+		uint64_t Size, LogId;
+		unsigned Place = 0;
+		bool Done = AppendRecord (Log, Record, Size, LogId);
+		if (Done && IsValid (Index, Size, LogId))
+		{
+			// Le plus souvent le seul score ajouté : au plus KTopScores
+			//  records décalés, sur place
+			BeginWrite (Index);
+			Done = CatchUp (Log, Size, Index, Place);
+			EndWrite (Index);
+
+			// Hors de la fenêtre d'écriture : les lecteurs n'attendent pas
+			//  le disque, et seuls les écrivains, sous le verrou, lisent
+			//  les champs de synchronisation
+			SyncLog (Log, Index);
+		}
+		else if (Done)
+		{
+			// Reconstruit à part depuis le journal, puis recopié d'un coup
+			CScoreIndex Fresh;
+			ClearIndex (Fresh, LogId);
+			Done = CatchUp (Log, Size, Fresh, Place);
+
+			// Les scores que l'ancien index savait pas encore sur disque
+			//  sont oubliés avec lui : tout le journal y va maintenant
+			if (fdatasync (Log) != 0)
+			{
+				Fresh.NbUnsynced    = 1;
+				Fresh.FirstUnsynced = time (NULL);
+			}
+			BeginWrite (Index);
+			memcpy ((char *) &Index + KIndexBody,
+					(const char *) &Fresh + KIndexBody,
+					sizeof (Fresh) - KIndexBody);
+			EndWrite (Index);
+		}
+		if (Rank) *Rank = Place;
+
+		// Fermer le fichier lâche aussi le verrou
+		close (Log);
+		return Done;
+	} // Add
+
+	bool CScoreStore::GetTop (unsigned Mode, unsigned Level,
+							  CScoreRecord * Top, unsigned & NbTop) const
+	{
+		NbTop = 0;
+		if (!m_Index || Mode >= KNbModes || Level >= KNbLevels) return false;
+
+		const CScoreIndex & Index = *m_Index;
+		const CTopTable & Table = Index.Tables [TableOf (Mode, Level)];
+		for (unsigned Try = 0; Try < KNbReadTries; ++Try)
+		{
+			const uint32_t Before = __atomic_load_n (&Index.Sequence,
+													 __ATOMIC_ACQUIRE);
+			if (Before & 1)
+			{
+				sched_yield ();
+				continue;
+			}
+			// Copié avant d'être vérifié : une valeur lue en pleine
+			//  écriture ne doit pas déborder
+			const bool IsIndex = 0 == memcmp (Index.Magic, KIndexMagic,
+											  sizeof (KIndexMagic));
+			const unsigned NbScores = min <uint32_t> (Table.NbScores,
+													  KTopScores);
+			memcpy (Top, Table.Scores, NbScores * sizeof (CScoreRecord));
+			__atomic_thread_fence (__ATOMIC_ACQUIRE);
+			if (__atomic_load_n (&Index.Sequence, __ATOMIC_RELAXED) != Before)
+				continue;
+			if (!IsIndex) return false;
+			NbTop = NbScores;
+			return true;
+		}
+		return false;
+	} // GetTop
+
+} // namespace nsNumberCrush
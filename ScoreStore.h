@@ -0,0 +1,137 @@
+/**
+*
+* @file ScoreStore.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Meilleurs scores : journal binaire en ajout seul, plus un index
+*        des KTopScores premiers de chaque mode et difficulté
+*
+* Les fichiers sont dans l'ordre des octets de la machine : ils ne sont
+*  pas faits pour passer d'une machine à l'autre.
+*
+*/
+
+#ifndef __SCORESTORE_H__
+#define __SCORESTORE_H__
+
+#include <cstdint>
+#include <string>
+
+namespace nsNumberCrush
+{
+	const unsigned KTopScores    = 10; ///< Scores kept per mode and level
+	const unsigned KPseudoLength = 16;
+
+/**
+ * \struct CScoreRecord
+ * \brief One game, as written in the log and in the index (32 bytes)
+ *
+ */
+	struct CScoreRecord
+	{
+		char          Pseudo [KPseudoLength]; ///< Padded with '\0'
+		std::uint32_t Score;
+		std::uint8_t  Mode;     ///< CGameMode::GetId
+		std::uint8_t  Level;    ///< GetLevel
+		std::uint16_t Reserved;
+		std::int64_t  Time;     ///< End of the game, seconds since 1970
+	}; // CScoreRecord
+
+/**
+ * \fn void MakeScoreRecord (CScoreRecord & Record,
+ *  const std::string & Pseudo, unsigned Score, unsigned Mode,
+ *  unsigned Level, std::int64_t Time)
+ * \brief Fill Record ; Pseudo is cut to KPseudoLength characters
+ *
+ */
+	void MakeScoreRecord (CScoreRecord & Record, const std::string & Pseudo,
+						  unsigned Score, unsigned Mode, unsigned Level,
+						  std::int64_t Time);
+
+/**
+ * \fn unsigned GetPseudoLength (const CScoreRecord & Record)
+ * \brief Number of characters of Record.Pseudo, without its padding
+ *
+ */
+	unsigned GetPseudoLength (const CScoreRecord & Record);
+
+	struct CScoreIndex;
+
+/**
+ * \class CScoreStore
+ * \brief Every score ever played, and the best ones of each mode and level
+ *
+ * Path.log holds every game, one record after the other, behind a short
+ *  header ; it only grows. Path.idx holds, for each mode and level, the
+ *  KTopScores best records (the highest score first, the oldest first
+ *  at equal scores) and how much of the log they account for : reading a
+ *  leaderboard costs KTopScores records, whatever the size of the log.
+ *
+ * A missing or damaged index, or one built from another log, is rebuilt
+ *  from the log, and an index behind the log (a game interrupted between
+ *  both writes) catches up with it.
+ *
+ * Several processes can share the files. Writers take turns on a lock of
+ *  the log (flock), from the append to the update of the index. The index
+ *  has a fixed size and stays mapped in memory : a new score moves at most
+ *  KTopScores records of one table, in place, under a sequence lock that
+ *  readers check instead of taking the lock. The log goes to disk
+ *  (fdatasync) once every few records, or at the first record added a few
+ *  seconds after the oldest one not synced : nothing runs between two
+ *  calls to Add, so the last records of a quiet store wait for the system
+ *  to write them. A rebuilt index syncs the whole log. The index never
+ *  goes to disk, the log being enough to rebuild it.
+ *
+ */
+	class CScoreStore
+	{
+		std::string   m_LogPath;
+		CScoreIndex * m_Index;  ///< Path.idx, 0 if it could not be mapped
+
+		CScoreStore (const CScoreStore &);
+		CScoreStore & operator = (const CScoreStore &);
+
+	  public :
+/**
+ * \fn CScoreStore (const std::string & Path)
+ * \brief Store in Path.log and Path.idx ; the log is created by the
+ *  first Add
+ *
+ */
+		explicit CScoreStore (const std::string & Path);
+
+		~CScoreStore ();
+
+/**
+ * \fn bool Add (const CScoreRecord & Record, unsigned * Rank = 0)
+ * \brief Append Record to the log, then update the index ; waits for
+ *  the other writers
+ * \param Rank If not null, set to the place of Record in the best scores
+ *  of its mode and level, from 1, or to 0 if it is not among them
+ * \return false if a file could not be written
+ *
+ */
+		bool Add (const CScoreRecord & Record, unsigned * Rank = 0);
+
+/**
+ * \fn bool GetTop (unsigned Mode, unsigned Level, CScoreRecord * Top,
+ *  unsigned & NbTop) const
+ * \brief The best scores of a mode and a level, copied from the index
+ *  without allocating anything
+ * \param Top Room for KTopScores records, filled with the best first
+ * \param NbTop Number of records copied, 0 if none was ever played
+ * \return false if the index could not be read : it is missing or
+ *  damaged, or writers kept changing it ; a later call may succeed
+ *
+ */
+		bool GetTop (unsigned Mode, unsigned Level, CScoreRecord * Top,
+					 unsigned & NbTop) const;
+
+	}; // CScoreStore
+
+} // namespace nsNumberCrush
+
+#endif /* __SCORESTORE_H__ */
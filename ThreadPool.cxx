@@ -0,0 +1,130 @@
+/**
+*
+* @file ThreadPool.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Groupe de threads avec vol de tâches
+*
+*/
+
+#include "ThreadPool.h"
+
+using namespace std;
+
+namespace nsNumberCrush
+{
+	namespace
+	{
+		// Pool et numéro du worker qui exécute le thread courant
+		thread_local const CThreadPool * CurrentPool   = 0;
+		thread_local unsigned            CurrentWorker = 0;
+
+	} // namespace
+
+	CThreadPool::CThreadPool (unsigned NbThreads)
+		: m_NbQueued (0), m_NbPending (0), m_Next (0), m_Stop (false)
+	{
+		if (0 == NbThreads) NbThreads = thread::hardware_concurrency ();
+		if (0 == NbThreads) NbThreads = 1;
+
+		for (unsigned i = 0; i < NbThreads; ++i)
+			m_Queues.push_back (unique_ptr <CQueue> (new CQueue));
+		for (unsigned i = 0; i < NbThreads; ++i)
+			m_Workers.push_back (thread (&CThreadPool::Run, this, i));
+	} // CThreadPool
+
+	CThreadPool::~CThreadPool ()
+	{
+		{
+			lock_guard <mutex> Lock (m_Mutex);
+			m_Stop = true;
+		}
+		m_Wake.notify_all ();
+		for (unsigned i = 0; i < m_Workers.size (); ++i)
+			m_Workers [i].join ();
+	} // ~CThreadPool
+
+	void CThreadPool::Submit (CTask Task)
+	{
+		unsigned Worker;
+		{
+			// Comptée avant d'être visible : un worker qui la prend aussitôt
+			//  ne peut pas faire passer les compteurs sous zéro, et un worker
+			//  qui voit m_NbQueued non nul ne s'endort pas
+			lock_guard <mutex> Lock (m_Mutex);
+			Worker = CurrentPool == this ? CurrentWorker
+										 : m_Next++ % m_Queues.size ();
+			++m_NbPending;
+			++m_NbQueued;
+		}
+		{
+			lock_guard <mutex> Lock (m_Queues [Worker]->Mutex);
+			m_Queues [Worker]->Tasks.push_back (Task);
+		}
+		m_Wake.notify_one ();
+	} // Submit
+
+	void CThreadPool::Wait ()
+	{
+		unique_lock <mutex> Lock (m_Mutex);
+		while (m_NbPending != 0)
+			m_Done.wait (Lock);
+	} // Wait
+
+	bool CThreadPool::Pop (unsigned Worker, CTask & Task)
+	{
+		// Sa propre file d'abord, par la fin
+		{
+			CQueue & Queue = *m_Queues [Worker];
+			lock_guard <mutex> Lock (Queue.Mutex);
+			if (!Queue.Tasks.empty ())
+			{
+				Task = Queue.Tasks.back ();
+				Queue.Tasks.pop_back ();
+				--m_NbQueued;
+				return true;
+			}
+		}
+		// Puis vol de la plus ancienne tâche d'un autre worker
+		for (unsigned i = 1; i < m_Queues.size (); ++i)
+		{
+			CQueue & Queue = *m_Queues [(Worker + i) % m_Queues.size ()];
+			lock_guard <mutex> Lock (Queue.Mutex);
+			if (!Queue.Tasks.empty ())
+			{
+				Task = Queue.Tasks.front ();
+				Queue.Tasks.pop_front ();
+				--m_NbQueued;
+				return true;
+			}
+		}
+		return false;
+	} // Pop
+
+	void CThreadPool::Run (unsigned Worker)
+	{
+		CurrentPool   = this;
+		CurrentWorker = Worker;
+
+		for (CTask Task; ; )
+		{
+			if (Pop (Worker, Task))
+			{
+				Task ();
+				Task = CTask ();
+				lock_guard <mutex> Lock (m_Mutex);
+				if (0 == --m_NbPending) m_Done.notify_all ();
+				continue;
+			}
+
+			unique_lock <mutex> Lock (m_Mutex);
+			while (!m_Stop && 0 == m_NbQueued)
+				m_Wake.wait (Lock);
+			if (m_Stop && 0 == m_NbQueued) return;
+		}
+	} // Run
+
+} // namespace nsNumberCrush
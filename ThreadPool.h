@@ -0,0 +1,93 @@
+/**
+*
+* @file ThreadPool.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Groupe de threads avec vol de tâches
+*
+*/
+
+#ifndef __THREADPOOL_H__
+#define __THREADPOOL_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nsNumberCrush
+{
+/**
+ * \class CThreadPool
+ * \brief Fixed set of workers, each with its own task queue
+ *
+ * A worker takes its newest task first ; when its queue is empty it
+ *  steals the oldest task of another worker.
+ *
+ */
+	class CThreadPool
+	{
+	  public :
+		typedef std::function <void ()> CTask;
+
+	  private :
+		struct CQueue
+		{
+			std::mutex          Mutex;
+			std::deque <CTask>  Tasks;
+		}; // CQueue
+
+		std::vector <std::unique_ptr <CQueue> > m_Queues;
+		std::vector <std::thread>               m_Workers;
+		std::mutex                              m_Mutex;
+		std::condition_variable                 m_Wake;
+		std::condition_variable                 m_Done;
+		std::atomic <unsigned>                  m_NbQueued;
+		unsigned                                m_NbPending;
+		unsigned                                m_Next;
+		bool                                    m_Stop;
+
+		bool Pop   (unsigned Worker, CTask & Task);
+		void Run   (unsigned Worker);
+
+		CThreadPool (const CThreadPool &);
+		CThreadPool & operator = (const CThreadPool &);
+
+	  public :
+/**
+ * \fn CThreadPool (unsigned NbThreads = 0)
+ * \param NbThreads Number of workers, 0 for one per core
+ *
+ */
+		explicit CThreadPool (unsigned NbThreads = 0);
+		~CThreadPool ();
+
+		unsigned GetNbThreads () const { return m_Workers.size (); }
+
+/**
+ * \fn void Submit (CTask Task)
+ * \brief Queue a task : on the calling worker if called from a task,
+ *  else on each worker in turn
+ *
+ */
+		void Submit (CTask Task);
+
+/**
+ * \fn void Wait ()
+ * \brief Block until every submitted task is finished
+ *
+ */
+		void Wait ();
+
+	}; // CThreadPool
+
+} // namespace nsNumberCrush
+
+#endif /* __THREADPOOL_H__ */
@@ -0,0 +1,72 @@
+/**
+*
+* @file Timer.cxx
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Compte à rebours et attente de saisie bornée dans le temps
+*
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <iostream>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include "Timer.h"
+
+using namespace std;
+using namespace std::chrono;
+
+namespace nsNumberCrush
+{
+	CCountdown::CCountdown (double Limit)
+		: m_Start (CClock::now ()),
+		  m_End (m_Start + duration_cast <CClock::duration> (
+						   duration <double> (Limit)))
+	{} // CCountdown
+
+	double CCountdown::GetElapsed () const
+	{
+		const CClock::time_point Now = min (CClock::now (), m_End);
+		return duration <double> (Now - m_Start).count ();
+	} // GetElapsed
+
+	double CCountdown::GetLeft () const
+	{
+		const CClock::time_point Now = min (CClock::now (), m_End);
+		return duration <double> (m_End - Now).count ();
+	} // GetLeft
+
+	bool WaitForInput (const CCountdown & Timer)
+	{
+		cout.flush ();
+		streambuf * Buffer = cin.rdbuf ();
+		for (;;)
+		{
+			// Ce qui est déjà tapé compte, sauf les blancs que >> sauterait
+			while (Buffer->in_avail () > 0)
+			{
+				if (!isspace (Buffer->sgetc ())) return true;
+				Buffer->sbumpc ();
+			}
+
+			// Arrondi au-dessus : ne pas se réveiller juste avant la fin
+			const int Timeout = int (Timer.GetLeft () * 1000) + 1;
+			if (Timer.IsOver ()) return false;
+
+			pollfd Input = { STDIN_FILENO, POLLIN, 0 };
+			const int NbReady = poll (&Input, 1, Timeout);
+			if (NbReady < 0 && errno != EINTR) return true;
+
+			// Lisible mais rien à lire : fin de fichier, cin la signalera
+			if (NbReady > 0 && Buffer->in_avail () <= 0) return true;
+		}
+	} // WaitForInput
+
+} // namespace nsNumberCrush
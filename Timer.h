@@ -0,0 +1,76 @@
+/**
+*
+* @file Timer.h
+*
+* @author Julien M., Alexandre M., Stéphane N., Amélie L.
+*
+* @date 18/10/2026
+*
+* @brief Compte à rebours et attente de saisie bornée dans le temps
+*
+*/
+
+#ifndef __TIMER_H__
+#define __TIMER_H__
+
+#include <chrono>
+
+namespace nsNumberCrush
+{
+/**
+ * \class CCountdown
+ * \brief Time limit measured on the monotonic clock, so that changing
+ *  the system time neither shortens nor lengthens a game
+ *
+ */
+	class CCountdown
+	{
+	  public :
+		typedef std::chrono::steady_clock CClock;
+
+	  private :
+		CClock::time_point m_Start;
+		CClock::time_point m_End;
+
+	  public :
+/**
+ * \fn CCountdown (double Limit)
+ * \brief Start counting down Limit seconds from now
+ *
+ */
+		explicit CCountdown (double Limit);
+
+/**
+ * \fn double GetElapsed () const
+ * \brief Seconds since the start, at most the limit
+ *
+ */
+		double GetElapsed () const;
+
+/**
+ * \fn double GetLeft () const
+ * \brief Seconds until the limit, 0 once it is reached
+ *
+ */
+		double GetLeft () const;
+
+		bool IsOver () const { return CClock::now () >= m_End; }
+
+	}; // CCountdown
+
+/**
+ * \fn bool WaitForInput (const CCountdown & Timer)
+ * \brief Flush cout, then wait until something other than blanks can be
+ *  read from cin, or until Timer is over
+ *
+ * Typed-ahead input is only seen if cin does not share the buffer of
+ *  stdin : call std::ios::sync_with_stdio (false) first.
+ *
+ * \return false if Timer ran out first
+ *
+ */
+	bool WaitForInput (const CCountdown & Timer);
+
+} // namespace nsNumberCrush
+
+#endif /* __TIMER_H__ */